@@ -0,0 +1,273 @@
+/****************************************************************************
+ * File: alloc.hpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Node allocation policies for the alistar containers.
+ * heap_alloc forwards to new/delete and is the default everywhere.
+ * pool_alloc draws fixed-size blocks from node_pool, which gives every
+ * thread its own heap in the style of mimalloc's free lists: a thread
+ * allocates from and frees into its own heap without atomics, while blocks
+ * freed by other threads are gathered in per-owner batches and pushed onto
+ * the owner's remote list with a single CAS. The owner reclaims the whole
+ * remote list with one exchange when its local list runs dry. Blocks are
+ * carved from 64 KiB aligned slabs whose header names the owning heap, so
+ * blocks carry no per-allocation header. Slabs are kept for reuse for the
+ * life of the process, and heaps of exited threads are adopted by new ones.
+ *
+ * Copyright (c) 2026 diyorsattarov. All rights reserved.
+ ****************************************************************************/
+
+#ifndef ALLOC_HPP
+#define ALLOC_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Default policy: one new/delete per node
+ */
+struct heap_alloc {
+    template <typename N, typename... Args>
+    static N* make(Args&&... args) { return new N(std::forward<Args>(args)...); }
+
+    template <typename N>
+    static void destroy(N* n) { delete n; }
+
+    template <typename N>
+    static void flush() {}
+};
+
+/**
+ * @brief Thread-caching pool of blocks of one size and alignment
+ * @tparam Size Block size in bytes
+ * @tparam Align Block alignment in bytes
+ */
+template <size_t Size, size_t Align>
+class node_pool {
+    public:
+        /**
+         * @brief Returns an uninitialized block
+         * @throws std::bad_alloc if a new slab cannot be obtained
+         */
+        static void* allocate() {
+            if (dead()) { return orphan_allocate(); }
+            return pop(mine());
+        }
+
+        /**
+         * @brief Returns a block to its owning heap
+         * @param p Block obtained from allocate() on any thread, or nullptr
+         * @note A block owned by another thread is held in this thread's batch
+         * until 64 accumulate, a block of a different owner is freed, flush() is
+         * called or the thread exits. Until then the owner cannot reuse it, so a
+         * thread that frees a few foreign blocks and then blocks should call
+         * flush() first.
+         */
+        static void deallocate(void* p) {
+            if (!p) return;
+            free_block* b = static_cast<free_block*>(p);
+            heap* owner = owner_of(b);
+            if (dead()) {
+                push_remote(owner, b, b);
+                return;
+            }
+            thread_state& s = ts();
+            if (owner == s.h) {
+                b->next = owner->local;
+                owner->local = b;
+                return;
+            }
+            // Gather frees for one owner and hand them over together
+            pending& pd = s.pd;
+            if (pd.owner != owner || pd.n >= batch) { flush(pd); }
+            b->next = pd.hd;
+            if (!pd.hd) { pd.tl = b; }
+            pd.hd = b;
+            pd.owner = owner;
+            ++pd.n;
+        }
+
+        /**
+         * @brief Hands this thread's batched remote frees to their owner now
+         * @note Call it at idle points, such as before blocking on new work;
+         * chan and clst do so for their own nodes
+         */
+        static void flush() {
+            if (!dead()) { flush(ts().pd); }
+        }
+
+    private:
+        struct free_block {
+            free_block* next;
+        };
+
+        struct heap {
+            free_block* local = nullptr;                // Owner-only free list
+            std::atomic<free_block*> remote{nullptr};   // Blocks freed by other threads
+            char* bump = nullptr;                       // Unused tail of the newest slab
+            char* end = nullptr;
+        };
+
+        struct slab_hdr {
+            heap* owner;
+        };
+
+        // Frees gathered for a single owner
+        struct pending {
+            heap* owner = nullptr;
+            free_block* hd = nullptr;
+            free_block* tl = nullptr;
+            size_t n = 0;
+        };
+
+        // Per-thread heap and pending batch; abandons the heap on thread exit
+        struct thread_state {
+            heap* h = nullptr;
+            pending pd;
+
+            thread_state() : h(adopt()) {}
+            ~thread_state() {
+                flush(pd);
+                dead() = true;
+                std::lock_guard<std::mutex> lk(global().m);
+                global().abandoned.push_back(h);
+            }
+        };
+
+        // Heaps of exited threads plus the fallback heap for late callers
+        struct registry {
+            std::mutex m;
+            std::vector<heap*> abandoned;
+            heap orphan;
+            std::mutex orphan_m;
+        };
+
+        static constexpr size_t slab_size = 64 * 1024;
+        static constexpr size_t batch = 64;     // Remote frees gathered before a CAS
+        static constexpr size_t align = Align > alignof(free_block) ? Align : alignof(free_block);
+        static constexpr size_t raw = Size > sizeof(free_block) ? Size : sizeof(free_block);
+        static constexpr size_t block = (raw + align - 1) / align * align;
+        static constexpr size_t first = (sizeof(slab_hdr) + align - 1) / align * align;
+
+        static_assert(align <= 4096, "node_pool alignment must not exceed 4096");
+        static_assert(first + 8 * block <= slab_size, "node_pool blocks must fit eight to a slab");
+
+        // Never destroyed, so frees from static destructors remain safe
+        static registry& global() {
+            static registry* r = new registry();
+            return *r;
+        }
+
+        // Trivially destructible, so it stays readable after thread_state is gone
+        static bool& dead() {
+            static thread_local bool d = false;
+            return d;
+        }
+
+        static thread_state& ts() {
+            static thread_local thread_state s;
+            return s;
+        }
+
+        static heap* mine() { return ts().h; }
+
+        /**
+         * @brief Reuses a heap left by an exited thread, or creates one
+         */
+        static heap* adopt() {
+            registry& g = global();
+            std::lock_guard<std::mutex> lk(g.m);
+            if (g.abandoned.empty()) { return new heap(); }
+            heap* h = g.abandoned.back();
+            g.abandoned.pop_back();
+            return h;
+        }
+
+        static heap* owner_of(void* p) {
+            const uintptr_t base = reinterpret_cast<uintptr_t>(p) & ~(uintptr_t(slab_size) - 1);
+            return reinterpret_cast<slab_hdr*>(base)->owner;
+        }
+
+        /**
+         * @brief Pushes the chain hd..tl onto owner's remote list
+         */
+        static void push_remote(heap* owner, free_block* hd, free_block* tl) {
+            free_block* old = owner->remote.load(std::memory_order_relaxed);
+            do {
+                tl->next = old;
+            } while (!owner->remote.compare_exchange_weak(old, hd,
+                        std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        static void flush(pending& pd) {
+            if (pd.n) { push_remote(pd.owner, pd.hd, pd.tl); }
+            pd = pending();
+        }
+
+        /**
+         * @brief Takes a block from h: local list, then remote list, then slab
+         * @pre The caller has exclusive use of h's local state
+         */
+        static void* pop(heap* h) {
+            if (!h->local) {
+                h->local = h->remote.exchange(nullptr, std::memory_order_acquire);
+            }
+            if (free_block* b = h->local) {
+                h->local = b->next;
+                return b;
+            }
+            if (h->bump == h->end) {
+                char* s = static_cast<char*>(::operator new(slab_size, std::align_val_t(slab_size)));
+                reinterpret_cast<slab_hdr*>(s)->owner = h;
+                h->bump = s + first;
+                h->end = s + first + (slab_size - first) / block * block;
+            }
+            void* p = h->bump;
+            h->bump += block;
+            return p;
+        }
+
+        static void* orphan_allocate() {
+            registry& g = global();
+            std::lock_guard<std::mutex> lk(g.orphan_m);
+            return pop(&g.orphan);
+        }
+};
+
+/**
+ * @brief Pooled policy: nodes come from the thread-caching node_pool
+ */
+struct pool_alloc {
+    template <typename N, typename... Args>
+    static N* make(Args&&... args) {
+        using pool = node_pool<sizeof(N), alignof(N)>;
+        void* p = pool::allocate();
+        try {
+            return new (p) N(std::forward<Args>(args)...);
+        } catch (...) {
+            pool::deallocate(p);
+            throw;
+        }
+    }
+
+    template <typename N>
+    static void destroy(N* n) {
+        if (!n) return;
+        n->~N();
+        node_pool<sizeof(N), alignof(N)>::deallocate(n);
+    }
+
+    template <typename N>
+    static void flush() { node_pool<sizeof(N), alignof(N)>::flush(); }
+};
+
+#endif // ALLOC_HPP
@@ -0,0 +1,146 @@
+/****************************************************************************
+ * File: test_alloc.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Test implementation for the node allocation policies.
+ * Covers block reuse and alignment in node_pool, frees from a foreign
+ * thread returning to the owner, heap adoption after thread exit, and
+ * object lifetime through pool_alloc. Each test uses its own block size so
+ * that the pools it inspects start out untouched.
+ ****************************************************************************/
+#include <alloc.hpp>
+#include <test_suite.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Tests that a freed block is handed out again by the same thread
+ */
+void test_reuse() {
+    using pool = node_pool<24, 8>;
+    void* a = pool::allocate();
+    void* b = pool::allocate();
+    tst_suite<int>::assert_eq(a != b, true, "Live blocks should be distinct");
+
+    pool::deallocate(a);
+    tst_suite<int>::assert_eq(pool::allocate() == a, true, "Freed block should be reused first");
+    pool::deallocate(b);
+    pool::deallocate(nullptr);  // Freeing nullptr is a no-op
+}
+
+/**
+ * @brief Tests that blocks honour the requested alignment and do not overlap
+ */
+void test_alignment() {
+    using pool = node_pool<24, 64>;
+    std::vector<char*> v;
+    for (int i = 0; i < 3000; ++i) {   // Spans several slabs
+        v.push_back(static_cast<char*>(pool::allocate()));
+    }
+    bool aligned = true;
+    for (char* p : v) { aligned &= reinterpret_cast<uintptr_t>(p) % 64 == 0; }
+    std::sort(v.begin(), v.end());
+    bool disjoint = true;
+    for (size_t i = 1; i < v.size(); ++i) { disjoint &= v[i] - v[i - 1] >= 24; }
+
+    tst_suite<int>::assert_eq(aligned, true, "Every block should be 64-byte aligned");
+    tst_suite<int>::assert_eq(disjoint, true, "Blocks should not overlap");
+    for (char* p : v) { pool::deallocate(p); }
+}
+
+/**
+ * @brief Tests that blocks freed by another thread go back to their owner
+ */
+void test_remote_free() {
+    using pool = node_pool<40, 8>;
+    std::vector<void*> v;
+    for (int i = 0; i < 200; ++i) { v.push_back(pool::allocate()); }
+
+    std::thread other([&]() {
+        for (void* p : v) { pool::deallocate(p); }
+        pool::flush();
+    });
+    other.join();
+
+    // The local list is empty, so the owner drains its remote list next
+    std::vector<void*> again;
+    for (int i = 0; i < 200; ++i) { again.push_back(pool::allocate()); }
+    std::sort(v.begin(), v.end());
+    std::sort(again.begin(), again.end());
+    tst_suite<int>::assert_eq(v == again, true, "Owner should reclaim the remotely freed blocks");
+    for (void* p : again) { pool::deallocate(p); }
+}
+
+/**
+ * @brief Tests that the heap of an exited thread is adopted by the next one
+ */
+void test_adoption() {
+    using pool = node_pool<56, 8>;
+    void* first = nullptr;
+    std::thread([&]() {
+        first = pool::allocate();
+        pool::deallocate(first);
+    }).join();
+
+    void* next = nullptr;
+    std::thread([&]() {
+        next = pool::allocate();
+        pool::deallocate(next);
+    }).join();
+    tst_suite<int>::assert_eq(first == next, true, "New thread should inherit the abandoned heap");
+}
+
+/**
+ * @brief Tests construction, destruction and constructor failure through pool_alloc
+ */
+void test_pool_alloc() {
+    struct tracked {
+        static int& live() { static int n = 0; return n; }
+        int v;
+        explicit tracked(int x) : v(x) {
+            if (x < 0) throw std::invalid_argument("negative");
+            ++live();
+        }
+        ~tracked() { --live(); }
+    };
+
+    tracked* a = pool_alloc::make<tracked>(7);
+    tst_suite<int>::assert_eq(a->v, 7, "Object should be constructed in place");
+    tst_suite<int>::assert_eq(tracked::live(), 1, "One object should be live");
+    pool_alloc::destroy(a);
+    tst_suite<int>::assert_eq(tracked::live(), 0, "Destroy should run the destructor");
+
+    try {
+        pool_alloc::make<tracked>(-1);
+        throw std::runtime_error("Should have thrown invalid_argument exception");
+    } catch (const std::invalid_argument&) {
+        // Expected behavior
+    }
+    tracked* b = pool_alloc::make<tracked>(8);
+    tst_suite<int>::assert_eq(b == a, true, "Block of a failed construction should be returned");
+    pool_alloc::destroy(b);
+    pool_alloc::destroy<tracked>(nullptr);
+}
+
+int main() {
+    // Create and configure test suite
+    tst_suite<int> suite;
+
+    // Add test cases
+    suite.add("Block Reuse", test_reuse);
+    suite.add("Block Alignment", test_alignment);
+    suite.add("Remote Free Returns to Owner", test_remote_free);
+    suite.add("Heap Adoption", test_adoption);
+    suite.add("Pool Alloc Lifetime", test_pool_alloc);
+    // Run all tests
+    suite.run();
+
+    return 0;
+}
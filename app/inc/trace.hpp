@@ -0,0 +1,232 @@
+/****************************************************************************
+ * File: trace.hpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Operation traces for the load generator. A trace is a
+ * sequence of add/rem/get records as captured from a service using lst<T>.
+ * Traces are stored either as text, one record per line ("a 42", "r",
+ * "g 7"), or in a compact binary form: the magic "ALTR", a version byte, then
+ * one op byte per record followed by its argument as an unsigned LEB128
+ * varint for add and get. Traces can also be synthesized from an operation
+ * mix and an index distribution.
+ *
+ * Copyright (c) 2026 diyorsattarov. All rights reserved.
+ ****************************************************************************/
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Operation kinds, encoded as their text mnemonic
+ */
+enum class trace_op : unsigned char { add = 'a', rem = 'r', get = 'g' };
+
+/**
+ * @brief One recorded operation; arg is the value for add, the index for get
+ */
+struct trace_rec {
+    trace_op op;
+    uint64_t arg;
+};
+
+using trace = std::vector<trace_rec>;
+
+constexpr char trace_magic[4] = {'A', 'L', 'T', 'R'};
+constexpr unsigned char trace_version = 1;
+
+/**
+ * @brief Parses a trace from a stream, detecting text or binary format
+ * @param in Stream opened in binary mode
+ * @return The records in order
+ * @throws std::runtime_error on malformed input
+ */
+inline trace read_trace(std::istream& in) {
+    trace t;
+    char magic[4] = {};
+    in.read(magic, 4);
+    const bool binary = in.gcount() == 4 && std::equal(magic, magic + 4, trace_magic);
+
+    if (binary) {
+        if (in.get() != trace_version) { throw std::runtime_error("Unsupported trace version"); }
+        int c;
+        while ((c = in.get()) != EOF) {
+            trace_rec r{static_cast<trace_op>(c), 0};
+            if (r.op == trace_op::add || r.op == trace_op::get) {
+                unsigned shift = 0;
+                int b;
+                do {
+                    b = in.get();
+                    if (b == EOF || shift > 63) { throw std::runtime_error("Truncated trace record"); }
+                    r.arg |= static_cast<uint64_t>(b & 0x7f) << shift;
+                    shift += 7;
+                } while (b & 0x80);
+            } else if (r.op != trace_op::rem) {
+                throw std::runtime_error("Unknown trace op");
+            }
+            t.push_back(r);
+        }
+        return t;
+    }
+
+    // Text format: rewind over whatever the magic probe consumed
+    in.clear();
+    in.seekg(0);
+    std::string line;
+    size_t lineno = 0;
+    while (std::getline(in, line)) {
+        ++lineno;
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream ls(line);
+        char op = 0;
+        ls >> op;
+        trace_rec r{static_cast<trace_op>(op), 0};
+        if (r.op == trace_op::add || r.op == trace_op::get) {
+            if (!(ls >> r.arg)) {
+                throw std::runtime_error("Missing argument on trace line " + std::to_string(lineno));
+            }
+        } else if (r.op != trace_op::rem) {
+            throw std::runtime_error("Unknown op on trace line " + std::to_string(lineno));
+        }
+        t.push_back(r);
+    }
+    return t;
+}
+
+/**
+ * @brief Reads a trace file
+ * @throws std::runtime_error if the file cannot be opened or parsed
+ */
+inline trace read_trace(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) { throw std::runtime_error("Cannot open trace " + path); }
+    return read_trace(in);
+}
+
+/**
+ * @brief Serializes a trace
+ * @param out Stream opened in binary mode
+ * @param t The records to write
+ * @param binary Whether to use the compact binary format
+ */
+inline void write_trace(std::ostream& out, const trace& t, bool binary) {
+    if (!binary) {
+        for (const trace_rec& r : t) {
+            out << static_cast<char>(r.op);
+            if (r.op != trace_op::rem) { out << ' ' << r.arg; }
+            out << '\n';
+        }
+        return;
+    }
+    out.write(trace_magic, 4);
+    out.put(static_cast<char>(trace_version));
+    for (const trace_rec& r : t) {
+        out.put(static_cast<char>(r.op));
+        if (r.op == trace_op::rem) continue;
+        uint64_t v = r.arg;
+        do {
+            unsigned char b = v & 0x7f;
+            v >>= 7;
+            out.put(static_cast<char>(v ? b | 0x80 : b));
+        } while (v);
+    }
+}
+
+/**
+ * @brief Writes a trace file
+ * @throws std::runtime_error if the file cannot be written
+ */
+inline void write_trace(const std::string& path, const trace& t, bool binary) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) { throw std::runtime_error("Cannot write trace " + path); }
+    write_trace(out, t, binary);
+}
+
+/**
+ * @brief Parameters for synthesizing a trace
+ */
+struct synth_params {
+    size_t ops = 1000000;       // Records to generate after the initial fill
+    size_t initial = 0;         // Adds emitted up front
+    unsigned add_w = 40;        // Relative weight of add
+    unsigned rem_w = 10;        // Relative weight of rem
+    unsigned get_w = 50;        // Relative weight of get
+    std::string index = "uniform";  // uniform, seq, skewed or tail
+    double skew = 3.0;          // Exponent for skewed; larger favours the head
+    uint64_t seed = 1;
+};
+
+/**
+ * @brief Generates a trace that is valid against an initially empty list
+ * @param p Operation mix and index distribution
+ * @return The generated records
+ * @throws std::invalid_argument on an unknown distribution or zero weights
+ */
+inline trace synth_trace(const synth_params& p) {
+    if (p.index != "uniform" && p.index != "seq" && p.index != "skewed" && p.index != "tail") {
+        throw std::invalid_argument("Unknown index distribution " + p.index);
+    }
+    const uint64_t total = uint64_t(p.add_w) + p.rem_w + p.get_w;
+    if (total == 0) { throw std::invalid_argument("Operation weights are all zero"); }
+
+    uint64_t x = p.seed ? p.seed : 1;
+    auto next = [&x]() {
+        // xorshift64*
+        x ^= x >> 12;
+        x ^= x << 25;
+        x ^= x >> 27;
+        return x * 0x2545f4914f6cdd1dULL;
+    };
+    auto unit = [&next]() { return (next() >> 11) * (1.0 / 9007199254740992.0); };
+
+    trace t;
+    t.reserve(p.initial + p.ops);
+    uint64_t size = 0;
+    uint64_t cursor = 0;    // Position of the sequential scan
+    for (size_t i = 0; i < p.initial; ++i) {
+        t.push_back({trace_op::add, next() >> 32});
+        ++size;
+    }
+    for (size_t i = 0; i < p.ops; ++i) {
+        uint64_t pick = next() % total;
+        // Operations that are invalid on an empty list become adds
+        if (pick < p.add_w || size == 0) {
+            t.push_back({trace_op::add, next() >> 32});
+            ++size;
+        } else if (pick < uint64_t(p.add_w) + p.rem_w) {
+            t.push_back({trace_op::rem, 0});
+            --size;
+        } else {
+            uint64_t idx;
+            if (p.index == "uniform") {
+                idx = next() % size;
+            } else if (p.index == "seq") {
+                if (cursor >= size) cursor = 0;
+                idx = cursor++;
+            } else if (p.index == "skewed") {
+                idx = static_cast<uint64_t>(size * std::pow(unit(), p.skew));
+                if (idx >= size) idx = size - 1;
+            } else {
+                idx = size - 1;
+            }
+            t.push_back({trace_op::get, idx});
+        }
+    }
+    return t;
+}
+
+#endif // TRACE_HPP
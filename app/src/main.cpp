@@ -1,6 +1,294 @@
-#include <node.hpp>
+/****************************************************************************
+ * File: main.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2024-10-05
+ * Last Modified: 2026-10-19
+ *
+ * Description: Trace-replay load generator. Replays recorded add/rem/get
+ * traces against a chosen container and reports throughput, per-operation
+ * latency percentiles and peak memory, or synthesizes traces from an
+ * operation mix and index distribution so production access patterns can
+ * be reproduced offline.
+ *
+ * Usage:
+ *   alistar_app.out replay <trace> [--container lst|list|deque|vector] [--stats]
+ *   alistar_app.out synth <trace> [--ops N] [--initial N] [--mix A:R:G]
+ *                   [--index uniform|seq|skewed|tail] [--skew X] [--seed S] [--text]
+ ****************************************************************************/
+
+#include <list.hpp>
+#include <trace.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+using clk = std::chrono::steady_clock;
+
+/**
+ * @brief Uniform add/rem/get over each replay target
+ */
+template <typename C> struct target;
+
+template <typename T, typename S> struct target<lst<T, S>> {
+    static void add(lst<T, S>& c, T v) { c.add(v); }
+    static void rem(lst<T, S>& c) { c.rem(); }
+    static bool get(lst<T, S>& c, size_t i, T& out) {
+        if (i >= c.size()) return false;
+        out = c.get(i);
+        return true;
+    }
+};
+
+template <typename T> struct target<std::list<T>> {
+    static void add(std::list<T>& c, T v) { c.push_back(v); }
+    static void rem(std::list<T>& c) { if (!c.empty()) c.pop_back(); }
+    static bool get(std::list<T>& c, size_t i, T& out) {
+        if (i >= c.size()) return false;
+        out = *std::next(c.begin(), static_cast<std::ptrdiff_t>(i));
+        return true;
+    }
+};
+
+template <typename T> struct target<std::deque<T>> {
+    static void add(std::deque<T>& c, T v) { c.push_back(v); }
+    static void rem(std::deque<T>& c) { if (!c.empty()) c.pop_back(); }
+    static bool get(std::deque<T>& c, size_t i, T& out) {
+        if (i >= c.size()) return false;
+        out = c[i];
+        return true;
+    }
+};
+
+template <typename T> struct target<std::vector<T>> {
+    static void add(std::vector<T>& c, T v) { c.push_back(v); }
+    static void rem(std::vector<T>& c) { if (!c.empty()) c.pop_back(); }
+    static bool get(std::vector<T>& c, size_t i, T& out) {
+        if (i >= c.size()) return false;
+        out = c[i];
+        return true;
+    }
+};
+
+/**
+ * @brief Peak resident set size of this process in bytes
+ */
+size_t peak_rss() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) { return pmc.PeakWorkingSetSize; }
+    return 0;
+#else
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+  #ifdef __APPLE__
+    return static_cast<size_t>(ru.ru_maxrss);
+  #else
+    return static_cast<size_t>(ru.ru_maxrss) * 1024;
+  #endif
+#endif
+}
+
+/**
+ * @brief Prints count and latency percentiles for one operation kind
+ */
+void report_latency(const char* name, std::vector<uint32_t>& ns) {
+    std::cout << "  " << std::left << std::setw(4) << name << std::right
+        << std::setw(10) << ns.size() << " ops";
+    if (ns.empty()) {
+        std::cout << "\n";
+        return;
+    }
+    std::sort(ns.begin(), ns.end());
+    auto pct = [&ns](double p) { return ns[static_cast<size_t>(p * (ns.size() - 1))]; };
+    std::cout << "  p50 " << pct(0.50) << " ns  p90 " << pct(0.90) << " ns  p99 " << pct(0.99)
+        << " ns  p99.9 " << pct(0.999) << " ns  max " << ns.back() << " ns\n";
+}
+
+/**
+ * @brief Replays t against a fresh container C and prints the results
+ */
+template <typename C>
+void replay(const trace& t, const std::string& name) {
+    using tg = target<C>;
+    C c;
+    std::vector<uint32_t> lat[3];
+    for (auto& l : lat) { l.reserve(t.size() / 3); }
+    size_t invalid = 0;
+    int64_t v = 0;
+    uint64_t sum = 0;
+
+    const size_t rss_before = peak_rss();
+    const auto start = clk::now();
+    for (const trace_rec& r : t) {
+        const auto t0 = clk::now();
+        size_t k = 0;
+        switch (r.op) {
+            case trace_op::add:
+                tg::add(c, static_cast<int64_t>(r.arg));
+                k = 0;
+                break;
+            case trace_op::rem:
+                tg::rem(c);
+                k = 1;
+                break;
+            case trace_op::get:
+                if (tg::get(c, static_cast<size_t>(r.arg), v)) {
+                    sum += static_cast<uint64_t>(v);
+                } else {
+                    ++invalid;
+                }
+                k = 2;
+                break;
+        }
+        lat[k].push_back(static_cast<uint32_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(clk::now() - t0).count()));
+    }
+    const double secs = std::chrono::duration<double>(clk::now() - start).count();
+
+    std::cout << "container " << name << ": " << t.size() << " ops in " << std::fixed
+        << std::setprecision(3) << secs << " s (" << std::setprecision(0)
+        << (secs > 0 ? t.size() / secs : 0.0) << " ops/s)\n";
+    report_latency("add", lat[0]);
+    report_latency("rem", lat[1]);
+    report_latency("get", lat[2]);
+    if (invalid) { std::cout << "  " << invalid << " get records were out of range\n"; }
+    std::cout << "  peak RSS " << peak_rss() / 1024 << " KiB (" << rss_before / 1024
+        << " KiB before replay)\n";
+    std::cout << "  checksum " << sum << "\n";
+}
+
+/**
+ * @brief Parses a whole non-negative decimal integer
+ * @return false on empty, signed, out-of-range or trailing input
+ */
+bool parse_count(const char* s, unsigned long long& out) {
+    if (*s < '0' || *s > '9') return false;
+    char* end = nullptr;
+    errno = 0;
+    out = std::strtoull(s, &end, 10);
+    return errno == 0 && *end == '\0';
+}
+
+/**
+ * @brief Parses a whole finite floating-point number
+ * @return false on empty, non-finite or trailing input
+ */
+bool parse_real(const char* s, double& out) {
+    if (!*s || std::isspace(static_cast<unsigned char>(*s))) return false;
+    char* end = nullptr;
+    errno = 0;
+    out = std::strtod(s, &end);
+    return errno == 0 && *end == '\0' && std::isfinite(out);
+}
+
+/**
+ * @brief Prints usage and returns the failure exit code
+ */
+int usage(const char* argv0) {
+    std::cerr << "usage:\n"
+        << "  " << argv0 << " replay <trace> [--container lst|list|deque|vector] [--stats]\n"
+        << "  " << argv0 << " synth <trace> [--ops N] [--initial N] [--mix A:R:G]\n"
+        << "      [--index uniform|seq|skewed|tail] [--skew X] [--seed S] [--text]\n";
+    return 1;
+}
 
 int main(int argc, char **argv) {
-   node<int> a(1);
-   return 0;
+    if (argc < 3) return usage(argv[0]);
+    const std::string cmd = argv[1];
+    const std::string path = argv[2];
+
+    try {
+        if (cmd == "replay") {
+            std::string container = "lst";
+            bool stats = false;
+            for (int i = 3; i < argc; ++i) {
+                const std::string flag = argv[i];
+                if (flag == "--container" && i + 1 < argc) {
+                    container = argv[++i];
+                } else if (flag == "--stats") {
+                    stats = true;
+                } else {
+                    return usage(argv[0]);
+                }
+            }
+            const trace t = read_trace(path);
+            if (container == "lst" && stats) {
+                replay<lst<int64_t, lst_stats>>(t, "lst (instrumented)");
+                lst_stats::dump(std::cout);
+            } else if (container == "lst") {
+                replay<lst<int64_t>>(t, container);
+            } else if (container == "list") {
+                replay<std::list<int64_t>>(t, container);
+            } else if (container == "deque") {
+                replay<std::deque<int64_t>>(t, container);
+            } else if (container == "vector") {
+                replay<std::vector<int64_t>>(t, container);
+            } else {
+                return usage(argv[0]);
+            }
+        } else if (cmd == "synth") {
+            synth_params p;
+            bool binary = true;
+            for (int i = 3; i < argc; ++i) {
+                const std::string flag = argv[i];
+                const bool has = i + 1 < argc;
+                unsigned long long n = 0;
+                if (flag == "--ops" && has) {
+                    if (!parse_count(argv[++i], n)) return usage(argv[0]);
+                    p.ops = static_cast<size_t>(n);
+                } else if (flag == "--initial" && has) {
+                    if (!parse_count(argv[++i], n)) return usage(argv[0]);
+                    p.initial = static_cast<size_t>(n);
+                } else if (flag == "--mix" && has) {
+                    char sep1 = 0, sep2 = 0;
+                    const std::string mix = argv[++i];
+                    std::istringstream ms(mix);
+                    if (mix.find('-') != std::string::npos) return usage(argv[0]);
+                    if (!(ms >> p.add_w >> sep1 >> p.rem_w >> sep2 >> p.get_w)
+                            || sep1 != ':' || sep2 != ':' || ms.peek() != EOF) return usage(argv[0]);
+                } else if (flag == "--index" && has) {
+                    p.index = argv[++i];
+                } else if (flag == "--skew" && has) {
+                    if (!parse_real(argv[++i], p.skew)) return usage(argv[0]);
+                } else if (flag == "--seed" && has) {
+                    if (!parse_count(argv[++i], n)) return usage(argv[0]);
+                    p.seed = n;
+                } else if (flag == "--text") {
+                    binary = false;
+                } else {
+                    return usage(argv[0]);
+                }
+            }
+            const trace t = synth_trace(p);
+            write_trace(path, t, binary);
+            std::cout << "wrote " << t.size() << " records to " << path << "\n";
+        } else {
+            return usage(argv[0]);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
 }
@@ -0,0 +1,147 @@
+/****************************************************************************
+ * File: test_trace.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Test implementation for the trace reader, writer and
+ * synthesizer used by the load generator. Verifies text and binary round
+ * trips, error reporting and that synthesized traces are always valid.
+ ****************************************************************************/
+#include <trace.hpp>
+#include <test_suite.hpp>
+#include <sstream>
+
+/**
+ * @brief Checks that two traces hold the same records
+ */
+bool same(const trace& a, const trace& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].op != b[i].op || a[i].arg != b[i].arg) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Tests parsing of the text format
+ */
+void test_text() {
+    std::istringstream in("# captured trace\na 5\na 6\n\ng 1\nr\n");
+    trace t = read_trace(in);
+    tst_suite<int>::assert_eq(static_cast<int>(t.size()), 4, "Four records should be read");
+    tst_suite<int>::assert_true(t[0].op == trace_op::add && t[0].arg == 5, "First record should be a 5");
+    tst_suite<int>::assert_true(t[2].op == trace_op::get && t[2].arg == 1, "Third record should be g 1");
+    tst_suite<int>::assert_true(t[3].op == trace_op::rem, "Last record should be r");
+
+    std::istringstream bad("a 1\nx 2\n");
+    try {
+        read_trace(bad);
+        throw std::logic_error("Should have thrown runtime_error");
+    } catch (const std::runtime_error& e) {
+        tst_suite<int>::assert_true(std::string(e.what()).find("line 2") != std::string::npos,
+                "Error should name the offending line");
+    }
+}
+
+/**
+ * @brief Tests text and binary round trips, including large arguments
+ */
+void test_round_trip() {
+    trace t = {{trace_op::add, 0}, {trace_op::add, 127}, {trace_op::add, 128},
+               {trace_op::get, 1}, {trace_op::rem, 0}, {trace_op::add, ~uint64_t(0)}};
+    for (bool binary : {false, true}) {
+        std::stringstream buf;
+        write_trace(buf, t, binary);
+        tst_suite<int>::assert_true(same(read_trace(buf), t), "Round trip should preserve records");
+    }
+
+    std::stringstream bin;
+    write_trace(bin, t, true);
+    // Header, then op byte plus 1, 1, 2, 1, 0 and 10 varint bytes
+    tst_suite<int>::assert_eq(static_cast<int>(bin.str().size()), 5 + 2 + 2 + 3 + 2 + 1 + 11,
+            "Binary records should use varint arguments");
+}
+
+/**
+ * @brief Tests that a truncated binary trace is rejected
+ */
+void test_truncated() {
+    std::stringstream buf;
+    write_trace(buf, {{trace_op::add, 300}}, true);
+    std::string s = buf.str();
+    std::istringstream in(s.substr(0, s.size() - 1));
+    try {
+        read_trace(in);
+        throw std::logic_error("Should have thrown runtime_error");
+    } catch (const std::runtime_error&) {
+        // Expected behavior
+    }
+}
+
+/**
+ * @brief Tests that synthesized traces never rem or get past the end
+ */
+void test_synth_valid() {
+    for (const char* dist : {"uniform", "seq", "skewed", "tail"}) {
+        synth_params p;
+        p.ops = 20000;
+        p.add_w = 30;
+        p.rem_w = 30;
+        p.get_w = 40;
+        p.index = dist;
+        trace t = synth_trace(p);
+        uint64_t size = 0;
+        bool valid = true;
+        for (const trace_rec& r : t) {
+            if (r.op == trace_op::add) ++size;
+            else if (r.op == trace_op::rem) valid = valid && size-- > 0;
+            else valid = valid && r.arg < size;
+        }
+        tst_suite<int>::assert_true(valid, std::string("Trace should be valid for ") + dist);
+        tst_suite<int>::assert_eq(static_cast<int>(t.size()), 20000, "Trace should have ops records");
+    }
+
+    synth_params p;
+    p.index = "zipfian";
+    try {
+        synth_trace(p);
+        throw std::logic_error("Should have thrown invalid_argument");
+    } catch (const std::invalid_argument&) {
+        // Expected behavior
+    }
+}
+
+/**
+ * @brief Tests that the sequential distribution walks indices in order
+ */
+void test_synth_seq() {
+    synth_params p;
+    p.ops = 100;
+    p.initial = 10;
+    p.add_w = 0;
+    p.rem_w = 0;
+    p.get_w = 1;
+    p.index = "seq";
+    trace t = synth_trace(p);
+    tst_suite<int>::assert_true(t[10].arg == 0 && t[19].arg == 9 && t[20].arg == 0,
+            "Sequential gets should scan and wrap");
+}
+
+int main() {
+    // Create and configure test suite
+    tst_suite<int> suite;
+
+    // Add test cases
+    suite.add("Text Format", test_text);
+    suite.add("Round Trip", test_round_trip);
+    suite.add("Truncated Binary", test_truncated);
+    suite.add("Synthesized Traces Are Valid", test_synth_valid);
+    suite.add("Sequential Distribution", test_synth_seq);
+    // Run all tests
+    suite.run();
+
+    return 0;
+}
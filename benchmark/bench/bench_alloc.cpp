@@ -0,0 +1,87 @@
+/****************************************************************************
+ * File: bench_alloc.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Allocation policy benchmarks. Runs 1 to 8 producer/consumer
+ * thread pairs; each producer builds lists and passes them over a channel
+ * to its consumer, which destroys them. Every node is therefore freed on a
+ * different thread from the one that allocated it, which is the pattern
+ * that serializes on a shared allocator. Compares heap_alloc with
+ * pool_alloc at each thread count.
+ ****************************************************************************/
+
+#include <benchmark.hpp>
+#include <chan.hpp>
+#include <list.hpp>
+#include <alloc.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+constexpr size_t lists = 2000;      // Lists handed over by each producer
+constexpr size_t nodes = 256;       // Nodes in each list
+constexpr size_t capacity = 16;     // Lists buffered between a pair
+
+/**
+ * @brief Runs pairs producer/consumer pairs with nodes from policy A
+ */
+template <typename A>
+void run_pairs(size_t pairs) {
+    using list_t = lst<size_t, lst_no_stats, A>;
+    std::vector<chan<list_t*>*> links;
+    for (size_t i = 0; i < pairs; ++i) { links.push_back(new chan<list_t*>(capacity)); }
+
+    std::vector<std::thread> ts;
+    for (size_t p = 0; p < pairs; ++p) {
+        chan<list_t*>& c = *links[p];
+        ts.emplace_back([&c]() {
+            for (size_t i = 0; i < lists; ++i) {
+                list_t* l = new list_t();
+                for (size_t j = 0; j < nodes; ++j) { l->add(j); }
+                c.push(l);
+            }
+            c.close();
+        });
+        ts.emplace_back([&c]() {
+            list_t* l = nullptr;
+            while (c.pop(l)) { delete l; }
+        });
+    }
+    for (auto& t : ts) { t.join(); }
+    for (auto* c : links) { delete c; }
+}
+
+#ifdef _WIN32
+// Enable ANSI escape sequences for Windows console
+void enable_virtual_terminal_processing() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+}
+#endif
+
+int main() {
+    #ifdef _WIN32
+        enable_virtual_terminal_processing();  // Enable colored output in Windows
+    #endif
+
+    benchmark_suite<int> bench;
+
+    for (size_t pairs = 1; pairs <= 8; pairs *= 2) {
+        const std::string n = std::to_string(pairs) + (pairs == 1 ? " pair" : " pairs");
+        bench.add("heap_alloc " + n, [pairs]() { run_pairs<heap_alloc>(pairs); }, 3);
+        bench.add("pool_alloc " + n, [pairs]() { run_pairs<pool_alloc>(pairs); }, 3);
+    }
+    bench.run();
+    return 0;
+}
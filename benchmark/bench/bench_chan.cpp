@@ -0,0 +1,123 @@
+/****************************************************************************
+ * File: bench_chan.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Pipeline benchmarks for the chan<T> class. Runs 2 to 4 stage
+ * pipelines, one thread per stage, connected by bounded channels that are
+ * drained with pop_batch(). Reports throughput through the timing results and
+ * end-to-end item latency percentiles measured from source to sink.
+ ****************************************************************************/
+
+#include <benchmark.hpp>
+#include <chan.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+using clk = std::chrono::steady_clock;
+
+constexpr size_t items = 20000;     // Items sent through each pipeline run
+constexpr size_t batch = 64;        // Maximum items taken per pop_batch()
+constexpr size_t capacity = 256;    // Buffer size of every channel
+
+/**
+ * @brief Runs one pipeline of the given number of stages
+ * @param stages Source, sink and stages - 2 forwarding stages
+ * @param lat Receives the source-to-sink latency of every item in ns
+ */
+void run_pipeline(size_t stages, std::vector<long long>& lat) {
+    std::vector<std::unique_ptr<chan<long long>>> links;
+    for (size_t i = 0; i + 1 < stages; ++i) {
+        links.emplace_back(new chan<long long>(capacity));
+    }
+
+    std::vector<std::thread> ts;
+    // Source stamps each item with its send time
+    ts.emplace_back([&]() {
+        for (size_t i = 0; i < items; ++i) {
+            links.front()->push(clk::now().time_since_epoch().count());
+        }
+        links.front()->close();
+    });
+    // Forwarding stages move whole batches downstream
+    for (size_t s = 1; s + 1 < stages; ++s) {
+        ts.emplace_back([&, s]() {
+            chan<long long>& in = *links[s - 1];
+            chan<long long>& out = *links[s];
+            lst<long long> b;
+            while (in.pop_batch(b, batch) > 0) {
+                for (size_t i = 0; i < b.size(); ++i) { out.push(b.get(i)); }
+                b = lst<long long>();
+            }
+            out.close();
+        });
+    }
+    // Sink records latency
+    lat.clear();
+    ts.emplace_back([&]() {
+        chan<long long>& in = *links.back();
+        lst<long long> b;
+        while (in.pop_batch(b, batch) > 0) {
+            const long long now = clk::now().time_since_epoch().count();
+            for (size_t i = 0; i < b.size(); ++i) { lat.push_back(now - b.get(i)); }
+            b = lst<long long>();
+        }
+    });
+    for (auto& t : ts) { t.join(); }
+}
+
+/**
+ * @brief Returns the p-th percentile of v in microseconds
+ */
+double percentile(std::vector<long long> v, double p) {
+    if (v.empty()) return 0.0;
+    size_t k = static_cast<size_t>(p / 100.0 * (v.size() - 1));
+    std::nth_element(v.begin(), v.begin() + k, v.end());
+    return v[k] / 1000.0;
+}
+
+#ifdef _WIN32
+// Enable ANSI escape sequences for Windows console
+void enable_virtual_terminal_processing() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+}
+#endif
+
+int main() {
+    #ifdef _WIN32
+        enable_virtual_terminal_processing();  // Enable colored output in Windows
+    #endif
+
+    benchmark_suite<int> bench;
+    std::vector<long long> lat[5];
+
+    for (size_t stages = 2; stages <= 4; ++stages) {
+        bench.add(std::to_string(stages) + "-stage pipeline (" + std::to_string(items) + ")",
+                [&lat, stages]() { run_pipeline(stages, lat[stages]); }, 5);
+    }
+    bench.run();
+
+    std::cout << "\nLatency (last run, μs):\n";
+    for (size_t stages = 2; stages <= 4; ++stages) {
+        std::cout << "  " << stages << "-stage: p50 " << percentile(lat[stages], 50)
+            << "  p99 " << percentile(lat[stages], 99)
+            << "  max " << percentile(lat[stages], 100) << "\n";
+    }
+    return 0;
+}
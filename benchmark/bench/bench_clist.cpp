@@ -0,0 +1,176 @@
+/****************************************************************************
+ * File: bench_clist.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Read/write mix benchmarks for the clst<T> class. Compares the
+ * lock-free read path against a lst<T> guarded by a single mutex at 95/5
+ * and 50/50 read/write ratios over several thread counts. The worker threads
+ * are started once and reused, so each timed run measures only the steady
+ * state loop; reads pick indices across the whole list.
+ ****************************************************************************/
+
+#include <benchmark.hpp>
+#include <clist.hpp>
+#include <list.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+constexpr size_t list_size = 256;       // Elements kept in the list
+constexpr size_t ops_thread = 50000;    // Operations per thread per run
+constexpr size_t max_threads = 8;
+
+/**
+ * @brief Fixed set of worker threads that run one job per round
+ */
+class crew {
+    public:
+        explicit crew(size_t n) {
+            for (size_t t = 0; t < n; ++t) { ts.emplace_back([this, t]() { work(t); }); }
+        }
+
+        ~crew() {
+            {
+                std::lock_guard<std::mutex> lk(m);
+                quit = true;
+                ++round;
+            }
+            cv.notify_all();
+            for (auto& t : ts) { t.join(); }
+        }
+
+        /**
+         * @brief Runs job(tid) on the first n workers and waits for all of them
+         */
+        void run(size_t n, std::function<void(size_t)> job) {
+            std::unique_lock<std::mutex> lk(m);
+            fn = std::move(job);
+            active = n;
+            pending = n;
+            ++round;
+            cv.notify_all();
+            done.wait(lk, [this]() { return pending == 0; });
+        }
+
+    private:
+        void work(size_t tid) {
+            unsigned long seen = 0;
+            for (;;) {
+                std::unique_lock<std::mutex> lk(m);
+                cv.wait(lk, [&]() { return round != seen; });
+                seen = round;
+                if (quit) return;
+                if (tid >= active) continue;
+                lk.unlock();
+                fn(tid);
+                lk.lock();
+                if (--pending == 0) { done.notify_one(); }
+            }
+        }
+
+        std::vector<std::thread> ts;
+        std::mutex m;
+        std::condition_variable cv;
+        std::condition_variable done;
+        std::function<void(size_t)> fn;
+        unsigned long round = 0;
+        size_t active = 0;
+        size_t pending = 0;
+        bool quit = false;
+};
+
+/**
+ * @brief Mixed workload: write_pct out of every 100 operations alternate
+ * between add and rem, the rest read a random element of the list
+ *
+ * Every thread adds before it removes, so the list never drops below
+ * list_size elements and any index below it is valid.
+ */
+template <typename Read, typename Add, typename Rem>
+void mixed(size_t tid, size_t write_pct, Read rd, Add ad, Rem rm) {
+    volatile int sink = 0;
+    bool grow = true;
+    uint32_t x = static_cast<uint32_t>(tid * 2654435761u + 1);
+    for (size_t i = 0; i < ops_thread; ++i) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        if (x % 100 < write_pct) {
+            if (grow) { ad(static_cast<int>(i)); } else { rm(); }
+            grow = !grow;
+        } else {
+            sink = sink + rd((x >> 8) % list_size);
+        }
+    }
+}
+
+#ifdef _WIN32
+// Enable ANSI escape sequences for Windows console
+void enable_virtual_terminal_processing() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+}
+#endif
+
+int main() {
+    #ifdef _WIN32
+        enable_virtual_terminal_processing();  // Enable colored output in Windows
+    #endif
+
+    benchmark_suite<int> bench;
+
+    clst<int> cl;
+    lst<int> ml;
+    std::mutex mm;
+    for (size_t i = 0; i < list_size; ++i) {
+        cl.add(static_cast<int>(i));
+        ml.add(static_cast<int>(i));
+    }
+    crew workers(max_threads);
+
+    for (size_t write_pct : {5, 50}) {
+        const std::string mix = std::to_string(100 - write_pct) + "/" + std::to_string(write_pct);
+        for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+            const std::string tag = " " + mix + " x" + std::to_string(threads);
+
+            bench.add("clst" + tag, [&cl, &workers, write_pct, threads]() {
+                workers.run(threads, [&](size_t tid) {
+                    mixed(tid, write_pct,
+                            [&](size_t i) { return cl.get(i); },
+                            [&](int v) { cl.add(v); },
+                            [&]() { cl.rem(); });
+                });
+            }, 3);
+
+            bench.add("lst+mutex" + tag, [&ml, &mm, &workers, write_pct, threads]() {
+                workers.run(threads, [&](size_t tid) {
+                    mixed(tid, write_pct,
+                            [&](size_t i) { std::lock_guard<std::mutex> lk(mm); return ml.get(i); },
+                            [&](int v) { std::lock_guard<std::mutex> lk(mm); ml.add(v); },
+                            [&]() { std::lock_guard<std::mutex> lk(mm); ml.rem(); });
+                });
+            }, 3);
+        }
+    }
+
+    std::cout << ops_thread << " operations per thread per run on a " << list_size
+        << "-element list, " << std::thread::hardware_concurrency() << " hardware threads\n";
+    bench.run();
+    return 0;
+}
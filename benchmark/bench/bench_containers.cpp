@@ -0,0 +1,369 @@
+/****************************************************************************
+ * File: bench_containers.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Workload-driven comparison of lst<T> against std::list,
+ * std::forward_list, std::deque and std::vector. Every workload (append,
+ * drain from back, random get, full traversal, copy, move) runs at sizes
+ * from 1K to 10M elements with int, 64-byte POD and std::string payloads,
+ * so later optimizations can be measured against the same matrix.
+ * Combinations whose cost is quadratic for a container are skipped once they
+ * exceed a fixed node-visit budget.
+ *
+ * Usage: bench_containers.out [--max-size N] [--workload NAME] [--payload NAME]
+ ****************************************************************************/
+
+#include <benchmark.hpp>
+#include <list.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <forward_list>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+constexpr double visit_budget = 2e8;    // Skip combinations whose node visits exceed this
+constexpr size_t random_gets = 1000;    // Lookups per random get iteration
+
+/**
+ * @brief 64-byte trivially copyable payload
+ */
+struct pod64 {
+    unsigned char b[64];
+};
+
+/**
+ * @brief Builds payload values and reduces them to a number for the sink
+ */
+template <typename T> struct payload;
+
+template <> struct payload<int> {
+    static constexpr const char* name = "int";
+    static int make(size_t i) { return static_cast<int>(i); }
+    static size_t touch(const int& v) { return static_cast<size_t>(v); }
+};
+
+template <> struct payload<pod64> {
+    static constexpr const char* name = "pod64";
+    static pod64 make(size_t i) {
+        pod64 p;
+        std::memset(p.b, static_cast<int>(i & 0xff), sizeof(p.b));
+        return p;
+    }
+    static size_t touch(const pod64& v) { return v.b[0] + v.b[63]; }
+};
+
+template <> struct payload<std::string> {
+    static constexpr const char* name = "string";
+    // Long enough to defeat the small string optimization
+    static std::string make(size_t i) { return "payload-string-value-" + std::to_string(i) + "-padding"; }
+    static size_t touch(const std::string& v) { return v.size(); }
+};
+
+/**
+ * @brief std::forward_list with a tail iterator so appends are O(1)
+ */
+template <typename T>
+class fwd {
+    public:
+        fwd() : tl(l.before_begin()), n(0) {}
+        fwd(const fwd& other) : l(other.l), tl(l.before_begin()), n(other.n) {
+            for (auto it = l.begin(); it != l.end(); ++it) { tl = it; }
+        }
+        fwd(fwd&& other) noexcept : l(std::move(other.l)), tl(l.before_begin()), n(other.n) {
+            if (n) { tl = other.tl; }
+            other.tl = other.l.before_begin();
+            other.n = 0;
+        }
+        fwd& operator=(fwd&& other) noexcept {
+            l = std::move(other.l);
+            n = other.n;
+            tl = n ? other.tl : l.before_begin();
+            other.tl = other.l.before_begin();
+            other.n = 0;
+            return *this;
+        }
+        void push_back(const T& v) {
+            tl = l.insert_after(tl, v);
+            ++n;
+        }
+        void pop_back() {
+            auto prev = l.before_begin();
+            while (std::next(prev) != tl) { ++prev; }
+            l.erase_after(prev);
+            tl = prev;
+            --n;
+        }
+        size_t size() const { return n; }
+        const std::forward_list<T>& base() const { return l; }
+
+    private:
+        std::forward_list<T> l;
+        typename std::forward_list<T>::iterator tl;
+        size_t n;
+};
+
+/**
+ * @brief Uniform operations over each container, plus cost hints
+ *
+ * back_cost and index_cost give node visits per pop_back and per indexed
+ * access as a fraction of n; 0 means constant time.
+ */
+template <typename C> struct ops;
+
+template <typename T> struct ops<lst<T>> {
+    static constexpr const char* name = "lst";
+    static constexpr double back_cost = 1.0;
+    static constexpr double index_cost = 0.5;
+    static void append(lst<T>& c, const T& v) { c.add(v); }
+    static void pop_back(lst<T>& c) { c.rem(); }
+    static size_t size(const lst<T>& c) { return c.size(); }
+    static T at(const lst<T>& c, size_t i) { return c.get(i); }
+    template <typename F> static void each(const lst<T>& c, F f) {
+        // lst has no iterators; ascending get() resumes from its cached node
+        for (size_t i = 0; i < c.size(); ++i) { f(c.get(i)); }
+    }
+};
+
+template <typename T> struct ops<std::list<T>> {
+    static constexpr const char* name = "list";
+    static constexpr double back_cost = 0.0;
+    static constexpr double index_cost = 0.5;
+    static void append(std::list<T>& c, const T& v) { c.push_back(v); }
+    static void pop_back(std::list<T>& c) { c.pop_back(); }
+    static size_t size(const std::list<T>& c) { return c.size(); }
+    static T at(const std::list<T>& c, size_t i) { return *std::next(c.begin(), i); }
+    template <typename F> static void each(const std::list<T>& c, F f) { for (const T& v : c) { f(v); } }
+};
+
+template <typename T> struct ops<fwd<T>> {
+    static constexpr const char* name = "fwd_list";
+    static constexpr double back_cost = 1.0;
+    static constexpr double index_cost = 0.5;
+    static void append(fwd<T>& c, const T& v) { c.push_back(v); }
+    static void pop_back(fwd<T>& c) { c.pop_back(); }
+    static size_t size(const fwd<T>& c) { return c.size(); }
+    static T at(const fwd<T>& c, size_t i) { return *std::next(c.base().begin(), i); }
+    template <typename F> static void each(const fwd<T>& c, F f) { for (const T& v : c.base()) { f(v); } }
+};
+
+template <typename T> struct ops<std::deque<T>> {
+    static constexpr const char* name = "deque";
+    static constexpr double back_cost = 0.0;
+    static constexpr double index_cost = 0.0;
+    static void append(std::deque<T>& c, const T& v) { c.push_back(v); }
+    static void pop_back(std::deque<T>& c) { c.pop_back(); }
+    static size_t size(const std::deque<T>& c) { return c.size(); }
+    static T at(const std::deque<T>& c, size_t i) { return c[i]; }
+    template <typename F> static void each(const std::deque<T>& c, F f) { for (const T& v : c) { f(v); } }
+};
+
+template <typename T> struct ops<std::vector<T>> {
+    static constexpr const char* name = "vector";
+    static constexpr double back_cost = 0.0;
+    static constexpr double index_cost = 0.0;
+    static void append(std::vector<T>& c, const T& v) { c.push_back(v); }
+    static void pop_back(std::vector<T>& c) { c.pop_back(); }
+    static size_t size(const std::vector<T>& c) { return c.size(); }
+    static T at(const std::vector<T>& c, size_t i) { return c[i]; }
+    template <typename F> static void each(const std::vector<T>& c, F f) { for (const T& v : c) { f(v); } }
+};
+
+/**
+ * @brief Command-line selection of the matrix
+ */
+struct options {
+    size_t max_size = 10000000;
+    std::string workload;   // Empty runs every workload
+    std::string payload;    // Empty runs every payload
+};
+
+volatile size_t sink = 0;
+
+/**
+ * @brief Fills c with n payload values
+ */
+template <typename C, typename T>
+void fill(C& c, size_t n) {
+    for (size_t i = 0; i < n; ++i) { ops<C>::append(c, payload<T>::make(i)); }
+}
+
+/**
+ * @brief Short label for a size, e.g. 10K or 1M
+ */
+std::string label(size_t n) {
+    if (n >= 1000000) return std::to_string(n / 1000000) + "M";
+    if (n >= 1000) return std::to_string(n / 1000) + "K";
+    return std::to_string(n);
+}
+
+/**
+ * @brief Registers every workload for container C holding T at size n
+ * @param release Frees the previous container's data; replaced by one for C
+ */
+template <typename C, typename T>
+void add_workloads(benchmark_suite<int>& bench, const options& opt, size_t n,
+        std::vector<std::string>& skipped, std::function<void()>& release) {
+    using O = ops<C>;
+    const std::string tag = std::string(payload<T>::name) + "/" + label(n) + " " + O::name;
+    // Roughly one iteration per million elements touched, at least one
+    const size_t iters = n >= 1000000 ? 1 : 1000000 / n < 20 ? 1000000 / n : 20;
+    auto want = [&](const char* w) { return opt.workload.empty() || opt.workload == w; };
+    auto afford = [&](const char* w, double visits) {
+        if (visits * iters <= visit_budget) return true;
+        skipped.push_back(std::string(w) + " " + tag);
+        return false;
+    };
+
+    // Shared per-case state survives between setup and the timed body
+    auto src = std::make_shared<C>();
+    auto dst = std::make_shared<std::optional<C>>();
+
+    // Every setup first empties the previous container, so only one holds data
+    auto prep = [prev = std::move(release)](auto f) {
+        return [prev, f]() {
+            if (prev) { prev(); }
+            f();
+        };
+    };
+    release = [src, dst]() {
+        *src = C();
+        dst->reset();
+    };
+
+    if (want("append")) {
+        bench.add("append " + tag, prep([src]() { *src = C(); }), [src, n]() { fill<C, T>(*src, n); }, iters);
+    }
+    if (want("drain") && afford("drain", O::back_cost * n * n / 2)) {
+        bench.add("drain " + tag, prep([src, n]() { *src = C(); fill<C, T>(*src, n); }), [src]() {
+            while (O::size(*src) > 0) { O::pop_back(*src); }
+        }, iters);
+    }
+    if (want("get") && afford("get", O::index_cost * random_gets * n)) {
+        bench.add("get " + tag, prep([src, n]() {
+            if (O::size(*src) != n) { *src = C(); fill<C, T>(*src, n); }
+        }), [src, n]() {
+            unsigned long long x = 88172645463325252ULL;
+            size_t acc = 0;
+            for (size_t i = 0; i < random_gets; ++i) {
+                x ^= x << 13;
+                x ^= x >> 7;
+                x ^= x << 17;
+                acc += payload<T>::touch(O::at(*src, static_cast<size_t>(x % n)));
+            }
+            sink = sink + acc;
+        }, iters);
+    }
+    if (want("traverse")) {
+        bench.add("traverse " + tag, prep([src, n]() {
+            if (O::size(*src) != n) { *src = C(); fill<C, T>(*src, n); }
+        }), [src]() {
+            size_t acc = 0;
+            O::each(*src, [&acc](const T& v) { acc += payload<T>::touch(v); });
+            sink = sink + acc;
+        }, iters);
+    }
+    if (want("copy")) {
+        bench.add("copy " + tag, prep([src, dst, n]() {
+            dst->reset();
+            if (O::size(*src) != n) { *src = C(); fill<C, T>(*src, n); }
+        }), [src, dst]() { dst->emplace(*src); }, iters);
+    }
+    if (want("move")) {
+        // Destroying the moved-to container happens in the next setup
+        bench.add("move " + tag, prep([src, dst, n]() {
+            dst->reset();
+            *src = C();
+            fill<C, T>(*src, n);
+        }), [src, dst]() { dst->emplace(std::move(*src)); }, iters);
+    }
+}
+
+/**
+ * @brief Runs the whole matrix for payload T
+ */
+template <typename T>
+void run_payload(const options& opt) {
+    if (!opt.payload.empty() && opt.payload != payload<T>::name) return;
+    for (size_t n = 1000; n <= opt.max_size; n *= 10) {
+        // Each size gets its own suite so memory is released between sizes
+        benchmark_suite<int> bench;
+        std::vector<std::string> skipped;
+        std::function<void()> release;
+        add_workloads<lst<T>, T>(bench, opt, n, skipped, release);
+        add_workloads<std::list<T>, T>(bench, opt, n, skipped, release);
+        add_workloads<fwd<T>, T>(bench, opt, n, skipped, release);
+        add_workloads<std::deque<T>, T>(bench, opt, n, skipped, release);
+        add_workloads<std::vector<T>, T>(bench, opt, n, skipped, release);
+        bench.run();
+        for (const auto& s : skipped) { std::cout << "[SKIP] " << s << " (quadratic)\n"; }
+    }
+}
+
+/**
+ * @brief Prints usage and returns the failure exit code
+ */
+int usage(const char* argv0) {
+    std::cerr << "usage: " << argv0
+        << " [--max-size N] [--workload append|drain|get|traverse|copy|move]"
+        << " [--payload int|pod64|string]\n";
+    return 1;
+}
+
+#ifdef _WIN32
+// Enable ANSI escape sequences for Windows console
+void enable_virtual_terminal_processing() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+}
+#endif
+
+int main(int argc, char **argv) {
+    #ifdef _WIN32
+        enable_virtual_terminal_processing();  // Enable colored output in Windows
+    #endif
+
+    options opt;
+    for (int i = 1; i < argc; ++i) {
+        const std::string flag = argv[i];
+        if (i + 1 >= argc) return usage(argv[0]);
+        const std::string val = argv[++i];
+        if (flag == "--max-size") {
+            char* end = nullptr;
+            opt.max_size = std::strtoull(val.c_str(), &end, 10);
+            if (val.empty() || *end || opt.max_size < 1000) return usage(argv[0]);
+        } else if (flag == "--workload") {
+            if (val != "append" && val != "drain" && val != "get" && val != "traverse"
+                    && val != "copy" && val != "move") return usage(argv[0]);
+            opt.workload = val;
+        } else if (flag == "--payload") {
+            if (val != "int" && val != "pod64" && val != "string") return usage(argv[0]);
+            opt.payload = val;
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    run_payload<int>(opt);
+    run_payload<pod64>(opt);
+    run_payload<std::string>(opt);
+    return 0;
+}
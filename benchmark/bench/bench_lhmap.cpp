@@ -0,0 +1,157 @@
+/****************************************************************************
+ * File: bench_lhmap.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Benchmarks for the lhmap<K, V> class against the usual pairing
+ * of a std::list for order with a std::unordered_map of iterators into it.
+ * Covers bulk insert/find/erase and an LRU cache workload.
+ ****************************************************************************/
+
+#include <benchmark.hpp>
+#include <lhmap.hpp>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+/**
+ * @brief Ordered map built from std::list + std::unordered_map, for comparison
+ */
+class list_map {
+    public:
+        void put(int k, int v) {
+            auto it = idx.find(k);
+            if (it != idx.end()) {
+                it->second->second = v;
+                return;
+            }
+            order.emplace_back(k, v);
+            idx.emplace(k, std::prev(order.end()));
+        }
+        int* find(int k) {
+            auto it = idx.find(k);
+            return it == idx.end() ? nullptr : &it->second->second;
+        }
+        void erase(int k) {
+            auto it = idx.find(k);
+            if (it == idx.end()) return;
+            order.erase(it->second);
+            idx.erase(it);
+        }
+        bool move_to_back(int k) {
+            auto it = idx.find(k);
+            if (it == idx.end()) return false;
+            order.splice(order.end(), order, it->second);
+            return true;
+        }
+        void pop_front() {
+            idx.erase(order.front().first);
+            order.pop_front();
+        }
+        size_t size() const { return order.size(); }
+
+    private:
+        std::list<std::pair<int, int>> order;
+        std::unordered_map<int, std::list<std::pair<int, int>>::iterator> idx;
+};
+
+/**
+ * @brief Pseudo-random key stream shared by both containers
+ */
+std::vector<int> make_keys(size_t n, unsigned range) {
+    std::vector<int> keys(n);
+    unsigned x = 2463534242u;
+    for (auto& k : keys) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        k = static_cast<int>(x % range);
+    }
+    return keys;
+}
+
+/**
+ * @brief LRU cache of the given capacity driven by keys
+ */
+template <typename M>
+size_t lru(M& m, const std::vector<int>& keys, size_t cap) {
+    size_t hits = 0;
+    for (int k : keys) {
+        if (m.move_to_back(k)) {
+            ++hits;
+            continue;
+        }
+        if (m.size() == cap) { m.pop_front(); }
+        m.put(k, k);
+    }
+    return hits;
+}
+
+/**
+ * @brief Inserts n distinct scattered keys, finds each one, then erases them all
+ */
+template <typename M>
+long long insert_find_erase(M& m, size_t n) {
+    long long sum = 0;
+    // An odd multiplier keeps keys distinct without favouring identity hashes
+    auto key = [](size_t i) { return static_cast<int>(static_cast<unsigned>(i) * 2654435761u); };
+    for (size_t i = 0; i < n; ++i) { m.put(key(i), 1); }
+    for (size_t i = 0; i < n; ++i) { sum += *m.find(key(i)); }
+    for (size_t i = 0; i < n; ++i) { m.erase(key(i)); }
+    return sum;
+}
+
+#ifdef _WIN32
+// Enable ANSI escape sequences for Windows console
+void enable_virtual_terminal_processing() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+}
+#endif
+
+int main() {
+    #ifdef _WIN32
+        enable_virtual_terminal_processing();  // Enable colored output in Windows
+    #endif
+
+    benchmark_suite<int> bench;
+    volatile long long sink = 0;
+
+    for (size_t n : {1000, 100000}) {
+        const std::string tag = " " + std::to_string(n / 1000) + "K";
+        bench.add("lhmap put/find/erase" + tag, [&sink, n]() {
+            lhmap<int, int> m;
+            sink = sink + insert_find_erase(m, n);
+        }, 10);
+        bench.add("list+map put/find/erase" + tag, [&sink, n]() {
+            list_map m;
+            sink = sink + insert_find_erase(m, n);
+        }, 10);
+    }
+
+    // 200K lookups over 20K keys into a 10K entry cache
+    const std::vector<int> keys = make_keys(200000, 20000);
+    bench.add("lhmap LRU (10K cap)", [&]() {
+        lhmap<int, int> m(10000);
+        sink = sink + static_cast<long long>(lru(m, keys, 10000));
+    }, 5);
+    bench.add("list+map LRU (10K cap)", [&]() {
+        list_map m;
+        sink = sink + static_cast<long long>(lru(m, keys, 10000));
+    }, 5);
+
+    bench.run();
+    return 0;
+}
@@ -0,0 +1,89 @@
+/****************************************************************************
+ * File: bench_list.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Benchmarks for the lst<T> class. Measures the legacy indexed
+ * loop pattern `for i in 0..size(): lst.get(i)` that relies on the cached
+ * position in get(), alongside access patterns that bypass the cache. A
+ * second pass repeats the workloads with lst_stats attached so traversal
+ * counts are printed next to each timing.
+ ****************************************************************************/
+
+#include <benchmark.hpp>
+#include <list.hpp>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+/**
+ * @brief Builds a list holding 0..n-1
+ */
+template <typename S = lst_no_stats>
+lst<int, S> make_list(size_t n) {
+    lst<int, S> l;
+    for (size_t i = 0; i < n; ++i) { l.add(static_cast<int>(i)); }
+    return l;
+}
+
+/**
+ * @brief Registers and runs the lst workloads with instrumentation policy S
+ * @param stats Whether to report lst_stats counters next to the timings
+ */
+template <typename S>
+void run_workloads(bool stats) {
+    benchmark_suite<int> bench;
+    if (stats) { bench.attach(lst_stats::reset, lst_stats::summary); }
+    volatile long long sink = 0;
+
+    const lst<int, S> big = make_list<S>(100000);
+    const lst<int, S> small = make_list<S>(1000);
+
+    // Legacy pattern: ascending index loop, resumes from the cached node
+    bench.add("Sequential get (100K)", [&]() {
+        long long sum = 0;
+        for (size_t i = 0; i < big.size(); ++i) { sum += big.get(i); }
+        sink = sink + sum;
+    }, 20);
+
+    // Strided loop still moves forward so the cache applies
+    bench.add("Strided get x16 (100K)", [&]() {
+        long long sum = 0;
+        for (size_t i = 0; i < big.size(); i += 16) { sum += big.get(i); }
+        sink = sink + sum;
+    }, 20);
+
+    // Descending loop restarts from the head on every call
+    bench.add("Reverse get (1K)", [&]() {
+        long long sum = 0;
+        for (size_t i = small.size(); i > 0; --i) { sum += small.get(i - 1); }
+        sink = sink + sum;
+    }, 20);
+
+    bench.run();
+}
+
+#ifdef _WIN32
+// Enable ANSI escape sequences for Windows console
+void enable_virtual_terminal_processing() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+}
+#endif
+
+int main() {
+    #ifdef _WIN32
+        enable_virtual_terminal_processing();  // Enable colored output in Windows
+    #endif
+
+    run_workloads<lst_no_stats>(false);
+    run_workloads<lst_stats>(true);
+    return 0;
+}
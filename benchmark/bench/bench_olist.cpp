@@ -0,0 +1,104 @@
+/****************************************************************************
+ * File: bench_olist.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Sequential scan benchmarks for the olst<T> class. Builds a
+ * list of 10 times its memory budget, so all but a tenth of it lives in the
+ * spill file, and scans it with for_each() and with an index loop. The same
+ * scans over a list whose budget holds everything give the in-memory
+ * baseline. Reports scan throughput and spill traffic after the timings.
+ * The spill file is normally still in the OS page cache, so these numbers
+ * bound the list's own overhead rather than the disk.
+ ****************************************************************************/
+
+#include <benchmark.hpp>
+#include <olist.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+using clk = std::chrono::steady_clock;
+
+constexpr size_t budget = 8u << 20;                     // Resident bytes of the spilling list
+constexpr size_t elems = 10 * budget / sizeof(long long);
+constexpr double mib = static_cast<double>(elems * sizeof(long long)) / (1 << 20);
+
+struct scan_result {
+    double secs = 0.0;              // Duration of the last timed scan
+    long long sum = 0;              // Keeps the scan from being optimized away
+};
+
+/**
+ * @brief Builds a list of elems values with the given budget
+ */
+std::unique_ptr<olst<long long>> build(size_t b) {
+    std::unique_ptr<olst<long long>> l(new olst<long long>(b));
+    for (size_t i = 0; i < elems; ++i) { l->add(static_cast<long long>(i)); }
+    return l;
+}
+
+#ifdef _WIN32
+// Enable ANSI escape sequences for Windows console
+void enable_virtual_terminal_processing() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+}
+#endif
+
+int main() {
+    #ifdef _WIN32
+        enable_virtual_terminal_processing();  // Enable colored output in Windows
+    #endif
+
+    benchmark_suite<int> bench;
+    const std::string n = " (" + std::to_string(static_cast<int>(mib)) + " MiB)";
+
+    std::unique_ptr<olst<long long>> spilled;
+    bench.add("append, 10x budget" + n, [&spilled]() { spilled = build(budget); }, 1);
+    std::unique_ptr<olst<long long>> resident;
+    bench.add("append, in memory" + n, [&resident]() { resident = build(2 * elems * sizeof(long long)); }, 1);
+
+    scan_result r[4];
+    auto for_each_scan = [](olst<long long>& l, scan_result& out) {
+        const clk::time_point t0 = clk::now();
+        long long s = 0;
+        l.for_each([&s](const long long& v) { s += v; });
+        out.secs = std::chrono::duration<double>(clk::now() - t0).count();
+        out.sum = s;
+    };
+    auto index_scan = [](olst<long long>& l, scan_result& out) {
+        const clk::time_point t0 = clk::now();
+        long long s = 0;
+        for (size_t i = 0; i < l.size(); ++i) { s += l.get(i); }
+        out.secs = std::chrono::duration<double>(clk::now() - t0).count();
+        out.sum = s;
+    };
+    bench.add("for_each, 10x budget" + n, [&]() { for_each_scan(*spilled, r[0]); }, 5);
+    bench.add("for_each, in memory" + n, [&]() { for_each_scan(*resident, r[1]); }, 5);
+    bench.add("get(i), 10x budget" + n, [&]() { index_scan(*spilled, r[2]); }, 5);
+    bench.add("get(i), in memory" + n, [&]() { index_scan(*resident, r[3]); }, 5);
+    bench.run();
+
+    const char* names[4] = {"for_each, 10x budget", "for_each, in memory",
+                            "get(i), 10x budget", "get(i), in memory"};
+    std::cout << "\nScan throughput (last run, MiB/s):\n";
+    for (int i = 0; i < 4; ++i) {
+        std::cout << "  " << names[i] << ": " << (r[i].secs > 0 ? mib / r[i].secs : 0.0)
+            << (r[i].sum == static_cast<long long>(elems) * (elems - 1) / 2 ? "" : "  (bad sum)") << "\n";
+    }
+    std::cout << "Spill file: " << spilled->bytes_written() / (1 << 20) << " MiB written, "
+        << spilled->bytes_read() / (1 << 20) << " MiB read\n";
+    return 0;
+}
@@ -0,0 +1,119 @@
+/****************************************************************************
+ * File: bench_plist.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Snapshot benchmarks for the plst<T> class. Compares taking a
+ * stable view of a list by sharing plst nodes against deep-copying a lst<T>
+ * through its copy constructor, in both time and memory. Memory is measured
+ * by replacing the global operator new and counting the bytes requested
+ * while each snapshot is taken.
+ ****************************************************************************/
+
+#include <benchmark.hpp>
+#include <list.hpp>
+#include <plist.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <string>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+static std::atomic<size_t> heap_bytes{0};   // Bytes requested from operator new
+static std::atomic<size_t> heap_calls{0};   // Number of operator new calls
+
+void* operator new(size_t n) {
+    heap_bytes.fetch_add(n, std::memory_order_relaxed);
+    heap_calls.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) { return p; }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+/**
+ * @brief Heap traffic of one call to fn, which keeps what it allocates alive
+ */
+struct heap_use {
+    size_t bytes;
+    size_t calls;
+};
+
+template <typename F>
+heap_use measure(F fn) {
+    const size_t b = heap_bytes.load();
+    const size_t c = heap_calls.load();
+    fn();
+    return heap_use{heap_bytes.load() - b, heap_calls.load() - c};
+}
+
+#ifdef _WIN32
+// Enable ANSI escape sequences for Windows console
+void enable_virtual_terminal_processing() {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+}
+#endif
+
+int main() {
+    #ifdef _WIN32
+        enable_virtual_terminal_processing();  // Enable colored output in Windows
+    #endif
+
+    benchmark_suite<int> bench;
+    volatile size_t sink = 0;
+
+    static lst<int> lists[3];
+    static plst<int> plists[3];
+    const size_t sizes[] = {1000, 10000, 100000};
+
+    std::cout << "Snapshot memory (measured heap bytes / allocations per snapshot):\n";
+    for (size_t s = 0; s < 3; ++s) {
+        const size_t n = sizes[s];
+        for (size_t i = 0; i < n; ++i) {
+            lists[s].add(static_cast<int>(i));
+            plists[s] = plists[s].push_front(static_cast<int>(i));
+        }
+
+        // Handles live in optionals so only node storage is counted
+        std::optional<lst<int>> lcopy;
+        std::optional<plst<int>> psnap;
+        std::optional<plst<int>> ppush;
+        const heap_use lu = measure([&]() { lcopy.emplace(lists[s]); });
+        const heap_use pu = measure([&]() { psnap.emplace(plists[s]); });
+        const heap_use qu = measure([&]() { ppush.emplace(psnap->push_front(-1)); });
+        std::cout << "  n=" << n << ": lst copy " << lu.bytes << " B / " << lu.calls
+            << ", plst snapshot " << pu.bytes << " B / " << pu.calls
+            << ", plst snapshot+push " << qu.bytes << " B / " << qu.calls << "\n";
+
+        const std::string tag = " (" + std::to_string(n) + ")";
+        bench.add("lst copy snapshot" + tag, [&sink, s]() {
+            lst<int> snap(lists[s]);
+            sink = sink + snap.size();
+        }, 20);
+        bench.add("plst snapshot" + tag, [&sink, s]() {
+            plst<int> snap(plists[s]);
+            sink = sink + snap.size();
+        }, 100000);
+        bench.add("plst snapshot+push" + tag, [&sink, s]() {
+            plst<int> snap(plists[s]);
+            plst<int> next = snap.push_front(-1);
+            sink = sink + next.size();
+        }, 100000);
+    }
+
+    bench.run();
+    return 0;
+}
@@ -5,11 +5,13 @@
  * Email: diyorsattarov@outlook.com
  *
  * Created: 2024-11-08
- * Last Modified: 2024-11-08
+ * Last Modified: 2026-10-19
  *
  * Description: A templated benchmark suite for performance testing. Provides
  * functionality to measure and compare execution times of different operations
- * with configurable iterations and detailed timing reports.
+ * with configurable iterations and detailed timing reports. Counters such
+ * as lst_stats can be attached so their summary is printed next to each
+ * timing result.
  ****************************************************************************/
 
 #ifndef BENCHMARK_HPP
@@ -36,7 +38,29 @@ class benchmark_suite {
          * @param iterations Number of times to run the benchmark
          */
         void add(const std::string& name, benchmark_case bc, size_t iterations = 1000) {
-            benchmarks.push_back({name, bc, iterations});
+            benchmarks.push_back({name, bc, iterations, nullptr});
+        }
+
+        /**
+         * @brief Adds a benchmark case with untimed per-iteration setup
+         * @param name Name of the benchmark
+         * @param setup Function run before every iteration, excluded from timing
+         * @param bc Function to benchmark
+         * @param iterations Number of times to run the benchmark
+         */
+        void add(const std::string& name, benchmark_case setup, benchmark_case bc,
+                size_t iterations) {
+            benchmarks.push_back({name, bc, iterations, setup});
+        }
+
+        /**
+         * @brief Attaches a counter source reported after each benchmark
+         * @param reset Called before each timed run to clear the counters
+         * @param summary Called after each timed run; its result is printed
+         */
+        void attach(std::function<void()> reset, std::function<std::string()> summary) {
+            counter_reset = reset;
+            counter_summary = summary;
         }
 
         /**
@@ -49,11 +73,13 @@ class benchmark_suite {
 
             std::cout << "\nRunning Benchmarks...\n\n";
 
-            for (const auto& [name, bc, iterations] : benchmarks) {
+            for (const auto& [name, bc, iterations, setup] : benchmarks) {
                 // Warm-up run
+                if (setup) { setup(); }
                 bc();
 
-                auto [total_time, avg_time] = time_function(bc, iterations);
+                if (counter_reset) { counter_reset(); }
+                auto [total_time, avg_time] = time_function(bc, iterations, setup);
 
                 std::cout << blue << "[BENCH] " << reset 
                     << std::left << std::setw(30) << name 
@@ -61,6 +87,9 @@ class benchmark_suite {
                     << avg_time << " μs "
                     << "(Total: " << total_time << " μs for " 
                     << iterations << " iterations)\n";
+                if (counter_summary) {
+                    std::cout << "        " << counter_summary() << "\n";
+                }
             }
             std::cout << "\nBenchmarking Complete!\n";
         }
@@ -70,16 +99,31 @@ class benchmark_suite {
             std::string name;
             benchmark_case bc;
             size_t iterations;
+            benchmark_case setup;
         };
 
         /**
          * @brief Times the execution of a function
          * @param func Function to time
          * @param iterations Number of iterations
+         * @param setup Optional untimed function run before each iteration
          * @return Pair of {time_span, avg_duration} in microseconds
          */
         std::pair<double, double> time_function(const benchmark_case& func, 
-                size_t iterations) const {
+                size_t iterations, const benchmark_case& setup = nullptr) const {
+            if (setup) {
+                // Time each iteration separately so setup is excluded
+                std::chrono::nanoseconds total(0);
+                for (size_t i = 0; i < iterations; ++i) {
+                    setup();
+                    auto start = std::chrono::high_resolution_clock::now();
+                    func();
+                    total += std::chrono::high_resolution_clock::now() - start;
+                }
+                double time_span = std::chrono::duration<double, std::micro>(total).count();
+                return {time_span, time_span / iterations};
+            }
+
             auto start = std::chrono::high_resolution_clock::now();
 
             for(size_t i = 0; i < iterations; ++i) {
@@ -95,6 +139,8 @@ class benchmark_suite {
         }
 
         std::vector<benchmark_info> benchmarks;
+        std::function<void()> counter_reset;            // Clears attached counters
+        std::function<std::string()> counter_summary;   // Reports attached counters
 };
 
 #endif // BENCHMARK_HPP
@@ -4,7 +4,7 @@
  * Email: diyorsattarov@outlook.com
  *
  * Created: 2024-11-08
- * Last Modified: 2024-11-08
+ * Last Modified: 2026-10-19
  *
  * Description: Test implementation for the benchmark_suite class. Verifies
  * the functionality of the benchmarking framework using the test suite.
@@ -78,6 +78,54 @@ void test_multiple_benchmarks() {
     }
 }
 
+/**
+ * @brief Tests that attached counters are reset and reported per benchmark
+ */
+void test_attached_counters() {
+    benchmark_suite<int> bench;
+    int counter = 0;
+    int resets = 0;
+
+    bench.add("Counted", [&counter]() { ++counter; }, 4);
+    bench.attach([&]() { counter = 0; ++resets; },
+            [&]() { return "count " + std::to_string(counter); });
+
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+    bench.run();
+    std::cout.rdbuf(old);
+
+    tst_suite<int>::assert_eq(resets, 1, "Counters should be reset once per benchmark");
+    tst_suite<int>::assert_true(buffer.str().find("count 4") != std::string::npos,
+            "Summary should cover only the timed iterations");
+}
+
+/**
+ * @brief Tests that setup runs before every iteration
+ */
+void test_setup() {
+    benchmark_suite<int> bench;
+    int setups = 0;
+    int runs = 0;
+    bool fresh = true;
+
+    bench.add("With Setup", [&]() { ++setups; fresh = true; },
+            [&]() {
+                if (!fresh) { throw std::runtime_error("Setup skipped"); }
+                fresh = false;
+                ++runs;
+            }, 3);
+
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+    bench.run();
+    std::cout.rdbuf(old);
+
+    // One warm-up plus three timed iterations
+    tst_suite<int>::assert_eq(setups, 4, "Setup should run before every iteration");
+    tst_suite<int>::assert_eq(runs, 4, "Benchmark should run once per setup");
+}
+
 #ifdef _WIN32
 // Enable ANSI escape sequences for Windows console
 void enable_virtual_terminal_processing() {
@@ -98,6 +146,8 @@ int main() {
     
     suite.add("Timing Accuracy", test_timing_accuracy);
     suite.add("Multiple Benchmarks", test_multiple_benchmarks);
+    suite.add("Attached Counters", test_attached_counters);
+    suite.add("Per-Iteration Setup", test_setup);
     
     suite.run();
     return 0;
@@ -0,0 +1,436 @@
+/****************************************************************************
+ * File: chan.hpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: This header file implements a templated bounded channel for
+ * passing values between pipeline stages. Values are held in a chain of
+ * node<T> objects; pop_batch() detaches many nodes at once and splices them
+ * into a lst<T> without copying. Blocking, try and timed variants of push
+ * and pop are provided, and close() wakes every waiter. When the compiler
+ * supports C++20 coroutines, push_async() and pop_async() return awaitables
+ * that suspend instead of blocking the calling thread. Nodes come from the
+ * allocation policy A (see alloc.hpp).
+ *
+ * Copyright (c) 2026 diyorsattarov. All rights reserved.
+ ****************************************************************************/
+
+#ifndef CHAN_HPP
+#define CHAN_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <alloc.hpp>
+#include <list.hpp>
+#include <node.hpp>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+    #include <coroutine>
+    #define CHAN_COROUTINES 1
+#else
+    #define CHAN_COROUTINES 0
+#endif
+
+template <typename T, typename A = heap_alloc>
+class chan {
+    public:
+        /**
+         * @brief Constructs an open, empty channel
+         * @param capacity Maximum number of buffered values
+         */
+        explicit chan(size_t capacity = 1024) : hd(nullptr), tl(nullptr), sz(0),
+                                                cap(capacity ? capacity : 1), cl(false) {}
+
+        // Waiters hold references to the channel, so it cannot be relocated
+        chan(const chan&) = delete;
+        chan& operator=(const chan&) = delete;
+        chan(chan&&) = delete;
+        chan& operator=(chan&&) = delete;
+
+        /**
+         * @brief Destructor that frees any buffered values
+         * @pre No thread or coroutine is waiting on the channel
+         */
+        ~chan() {
+            while (hd) {
+                node<T>* tmp = hd;
+                hd = hd->next();
+                A::destroy(tmp);
+            }
+        }
+
+        /**
+         * @brief Pushes a value, blocking while the channel is full
+         * @param v The value to push
+         * @return false if the channel was closed
+         */
+        bool push(const T& v) {
+            node<T>* n = A::template make<node<T>>(v);
+            std::unique_lock<std::mutex> lk(m);
+            nf.wait(lk, [this]() { return cl || sz < cap; });
+            return enqueue(lk, n);
+        }
+
+        /**
+         * @brief Pushes a value if there is room
+         * @param v The value to push
+         * @return false if the channel is full or closed
+         */
+        bool try_push(const T& v) {
+            std::unique_lock<std::mutex> lk(m);
+            if (cl || sz >= cap) return false;
+            return enqueue(lk, A::template make<node<T>>(v));
+        }
+
+        /**
+         * @brief Pushes a value, waiting at most d for room
+         * @param v The value to push
+         * @param d Maximum time to wait
+         * @return false on timeout or if the channel was closed
+         */
+        template <typename Rep, typename Period>
+        bool push_for(const T& v, const std::chrono::duration<Rep, Period>& d) {
+            node<T>* n = A::template make<node<T>>(v);
+            std::unique_lock<std::mutex> lk(m);
+            if (!nf.wait_for(lk, d, [this]() { return cl || sz < cap; })) {
+                lk.unlock();
+                A::destroy(n);
+                return false;
+            }
+            return enqueue(lk, n);
+        }
+
+        /**
+         * @brief Pops a value, blocking while the channel is empty
+         * @param out Receives the popped value
+         * @return false once the channel is closed and drained
+         */
+        bool pop(T& out) {
+            std::unique_lock<std::mutex> lk(m);
+            idle();
+            ne.wait(lk, [this]() { return cl || sz > 0; });
+            return dequeue(lk, out);
+        }
+
+        /**
+         * @brief Pops a value if one is buffered
+         * @param out Receives the popped value
+         * @return false if the channel is empty
+         */
+        bool try_pop(T& out) {
+            std::unique_lock<std::mutex> lk(m);
+            return dequeue(lk, out);
+        }
+
+        /**
+         * @brief Pops a value, waiting at most d for one to arrive
+         * @param out Receives the popped value
+         * @param d Maximum time to wait
+         * @return false on timeout or once the channel is closed and drained
+         */
+        template <typename Rep, typename Period>
+        bool pop_for(T& out, const std::chrono::duration<Rep, Period>& d) {
+            std::unique_lock<std::mutex> lk(m);
+            idle();
+            ne.wait_for(lk, d, [this]() { return cl || sz > 0; });
+            return dequeue(lk, out);
+        }
+
+        /**
+         * @brief Moves up to max buffered values into out, blocking until at
+         *        least one is available
+         * @param out List the detached nodes are spliced onto; it must share
+         *        the channel's allocation policy
+         * @param max Maximum number of values to take
+         * @return Number of values taken; 0 once the channel is closed and drained
+         * @note Taking everything buffered is O(1); a partial batch walks max nodes
+         */
+        template <typename S>
+        size_t pop_batch(lst<T, S, A>& out, size_t max) {
+            std::unique_lock<std::mutex> lk(m);
+            idle();
+            ne.wait(lk, [this]() { return cl || sz > 0; });
+            return dequeue_batch(lk, out, max);
+        }
+
+        /**
+         * @brief Moves up to max buffered values into out without blocking
+         * @return Number of values taken
+         */
+        template <typename S>
+        size_t try_pop_batch(lst<T, S, A>& out, size_t max) {
+            std::unique_lock<std::mutex> lk(m);
+            return dequeue_batch(lk, out, max);
+        }
+
+        /**
+         * @brief Closes the channel
+         * @post Pushes fail; pops drain what is buffered and then fail.
+         *       All blocked threads and suspended coroutines are woken.
+         */
+        void close() {
+            std::unique_lock<std::mutex> lk(m);
+            cl = true;
+            std::deque<pop_waiter*> pops;
+            std::deque<push_waiter*> pushes;
+            pops.swap(pw);
+            pushes.swap(uw);
+            lk.unlock();
+            ne.notify_all();
+            nf.notify_all();
+            for (pop_waiter* w : pops) { w->wake(); }
+            for (push_waiter* w : pushes) {
+                w->ok = false;
+                w->wake();
+            }
+        }
+
+        /**
+         * @brief Checks whether close() has been called
+         */
+        bool closed() const {
+            std::lock_guard<std::mutex> lk(m);
+            return cl;
+        }
+
+        /**
+         * @brief Returns the number of buffered values
+         */
+        size_t size() const {
+            std::lock_guard<std::mutex> lk(m);
+            return sz;
+        }
+
+        /**
+         * @brief Returns the maximum number of buffered values
+         */
+        size_t capacity() const { return cap; }
+
+    private:
+        /**
+         * @brief Returns batched node frees to their owners before a consumer blocks
+         * @pre The lock is held
+         */
+        void idle() {
+            if (!cl && sz == 0) { A::template flush<node<T>>(); }
+        }
+
+        // Suspended consumer; receives a value directly from a producer
+        struct pop_waiter {
+            std::optional<T> r;
+            virtual void wake() = 0;
+            virtual ~pop_waiter() = default;
+        };
+
+        // Suspended producer; its value is enqueued once room frees up
+        struct push_waiter {
+            T v;
+            bool ok;
+            explicit push_waiter(const T& val) : v(val), ok(false) {}
+            virtual void wake() = 0;
+            virtual ~push_waiter() = default;
+        };
+
+        /**
+         * @brief Hands n to a suspended consumer or links it at the tail
+         * @pre The lock is held, the channel is open and has room
+         * @post The lock is released
+         */
+        bool enqueue(std::unique_lock<std::mutex>& lk, node<T>* n) {
+            if (cl) {
+                lk.unlock();
+                A::destroy(n);
+                return false;
+            }
+            if (!pw.empty()) {
+                // A consumer is only suspended while the buffer is empty
+                pop_waiter* w = pw.front();
+                pw.pop_front();
+                lk.unlock();
+                w->r = n->get();
+                A::destroy(n);
+                w->wake();
+                return true;
+            }
+            link(n);
+            lk.unlock();
+            ne.notify_one();
+            return true;
+        }
+
+        /**
+         * @brief Unlinks the head into out and refills from a suspended producer
+         * @param out A T, or a std::optional<T> so T need not be default-constructible
+         * @pre The lock is held
+         * @post The lock is released
+         */
+        template <typename Out>
+        bool dequeue(std::unique_lock<std::mutex>& lk, Out& out) {
+            if (sz == 0) return false;
+            node<T>* n = hd;
+            hd = hd->next();
+            if (!hd) tl = nullptr;
+            --sz;
+            push_waiter* w = refill();
+            lk.unlock();
+            out = n->get();
+            A::destroy(n);
+            if (w) {
+                w->wake();
+            } else {
+                nf.notify_one();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Detaches up to max nodes and splices them onto out
+         * @pre The lock is held
+         * @post The lock is released
+         */
+        template <typename S>
+        size_t dequeue_batch(std::unique_lock<std::mutex>& lk, lst<T, S, A>& out, size_t max) {
+            if (sz == 0 || max == 0) return 0;
+            size_t take = max < sz ? max : sz;
+            node<T>* first = hd;
+            node<T>* last = tl;
+            if (take == sz) {
+                hd = nullptr;
+                tl = nullptr;
+            } else {
+                last = hd;
+                for (size_t i = 1; i < take; ++i) { last = last->next(); }
+                hd = last->next();
+            }
+            sz -= take;
+            std::vector<push_waiter*> woken;
+            while (push_waiter* w = refill()) { woken.push_back(w); }
+            lk.unlock();
+            out.splice_back(first, last, take);
+            nf.notify_all();
+            for (push_waiter* w : woken) { w->wake(); }
+            return take;
+        }
+
+        /**
+         * @brief Moves one suspended producer's value into the buffer if room allows
+         * @pre The lock is held
+         * @return The producer to wake, or nullptr
+         */
+        push_waiter* refill() {
+            if (uw.empty() || sz >= cap) return nullptr;
+            push_waiter* w = uw.front();
+            uw.pop_front();
+            link(A::template make<node<T>>(w->v));
+            w->ok = true;
+            return w;
+        }
+
+        /**
+         * @brief Links n at the tail of the buffer
+         * @pre The lock is held
+         */
+        void link(node<T>* n) {
+            if (!tl) {
+                hd = n;
+            } else {
+                tl->l(n);
+            }
+            tl = n;
+            ++sz;
+        }
+
+    public:
+#if CHAN_COROUTINES
+        /**
+         * @brief Awaitable returned by pop_async()
+         * @note The coroutine may be resumed on the thread that pushes or closes
+         */
+        class pop_awaiter : private pop_waiter {
+            public:
+                explicit pop_awaiter(chan& c) : c(c) {}
+                bool await_ready() const noexcept { return false; }
+                bool await_suspend(std::coroutine_handle<> hnd) {
+                    h = hnd;
+                    std::unique_lock<std::mutex> lk(c.m);
+                    if (c.sz > 0) {
+                        c.dequeue(lk, this->r);
+                        return false;
+                    }
+                    if (c.cl) return false;
+                    c.idle();
+                    c.pw.push_back(this);
+                    return true;
+                }
+                std::optional<T> await_resume() { return std::move(this->r); }
+
+            private:
+                void wake() override { h.resume(); }
+
+                chan& c;                    // Channel being popped from
+                std::coroutine_handle<> h;  // Suspended coroutine
+        };
+
+        /**
+         * @brief Awaitable returned by push_async()
+         * @note The coroutine may be resumed on the thread that pops or closes
+         */
+        class push_awaiter : private push_waiter {
+            public:
+                push_awaiter(chan& c, const T& v) : push_waiter(v), c(c) {}
+                bool await_ready() const noexcept { return false; }
+                bool await_suspend(std::coroutine_handle<> hnd) {
+                    h = hnd;
+                    std::unique_lock<std::mutex> lk(c.m);
+                    if (c.cl) return false;
+                    if (c.sz < c.cap || !c.pw.empty()) {
+                        this->ok = c.enqueue(lk, A::template make<node<T>>(this->v));
+                        return false;
+                    }
+                    c.uw.push_back(this);
+                    return true;
+                }
+                bool await_resume() const { return this->ok; }
+
+            private:
+                void wake() override { h.resume(); }
+
+                chan& c;                    // Channel being pushed to
+                std::coroutine_handle<> h;  // Suspended coroutine
+        };
+
+        /**
+         * @brief Pops a value, suspending the calling coroutine while empty
+         * @return Awaitable yielding the value, or std::nullopt once closed and drained
+         */
+        pop_awaiter pop_async() { return pop_awaiter(*this); }
+
+        /**
+         * @brief Pushes a value, suspending the calling coroutine while full
+         * @return Awaitable yielding false if the channel was closed
+         */
+        push_awaiter push_async(const T& v) { return push_awaiter(*this, v); }
+#endif
+
+    private:
+        node<T>* hd;                    // Oldest buffered value
+        node<T>* tl;                    // Newest buffered value
+        size_t sz;                      // Number of buffered values
+        const size_t cap;               // Maximum number of buffered values
+        bool cl;                        // Set once close() is called
+        mutable std::mutex m;           // Guards every member above and the waiter queues
+        std::condition_variable ne;     // Signalled when a value is buffered or on close
+        std::condition_variable nf;     // Signalled when room frees up or on close
+        std::deque<pop_waiter*> pw;     // Suspended consumers, oldest first
+        std::deque<push_waiter*> uw;    // Suspended producers, oldest first
+};
+
+#endif // CHAN_HPP
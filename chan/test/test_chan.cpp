@@ -0,0 +1,261 @@
+/****************************************************************************
+ * File: test_chan.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Test implementation for the chan<T> class. Covers try, timed
+ * and blocking push/pop, close semantics, batch dequeue by splicing, and a
+ * multi-threaded producer/consumer run. When built as C++20 the coroutine
+ * awaitables are exercised as well.
+ ****************************************************************************/
+#include <chan.hpp>
+#include <test_suite.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#if CHAN_COROUTINES
+/**
+ * @brief Minimal eagerly started coroutine used to drive the awaitables
+ */
+struct task {
+    struct promise_type {
+        task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+#endif
+
+/**
+ * @brief Tests non-blocking push and pop against the capacity
+ */
+void test_try_push_pop() {
+    chan<int> c(2);
+    tst_suite<int>::assert_true(c.try_push(1), "First push should succeed");
+    tst_suite<int>::assert_true(c.try_push(2), "Second push should succeed");
+    tst_suite<int>::assert_true(!c.try_push(3), "Push into a full channel should fail");
+
+    int v = 0;
+    tst_suite<int>::assert_true(c.try_pop(v), "Pop should succeed");
+    tst_suite<int>::assert_eq(v, 1, "Values should come out in FIFO order");
+    tst_suite<int>::assert_true(c.try_pop(v), "Second pop should succeed");
+    tst_suite<int>::assert_eq(v, 2, "Second value should be 2");
+    tst_suite<int>::assert_true(!c.try_pop(v), "Pop from an empty channel should fail");
+}
+
+/**
+ * @brief Tests that timed operations give up after their deadline
+ */
+void test_timed() {
+    chan<int> c(1);
+    int v = 0;
+    tst_suite<int>::assert_true(!c.pop_for(v, std::chrono::milliseconds(5)),
+            "pop_for on an empty channel should time out");
+    tst_suite<int>::assert_true(c.push_for(7, std::chrono::milliseconds(5)),
+            "push_for with room should succeed");
+    tst_suite<int>::assert_true(!c.push_for(8, std::chrono::milliseconds(5)),
+            "push_for on a full channel should time out");
+    tst_suite<int>::assert_true(c.pop_for(v, std::chrono::milliseconds(5)),
+            "pop_for with a value should succeed");
+    tst_suite<int>::assert_eq(v, 7, "Timed pop should return 7");
+}
+
+/**
+ * @brief Tests that close drains buffered values and wakes blocked threads
+ */
+void test_close() {
+    chan<int> c(4);
+    c.push(1);
+    c.push(2);
+
+    std::atomic<bool> woke{false};
+    chan<int> empty;
+    std::thread blocked([&]() {
+        int v = 0;
+        woke = !empty.pop(v);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    empty.close();
+    blocked.join();
+    tst_suite<int>::assert_true(woke, "close() should wake a blocked pop with false");
+
+    c.close();
+    tst_suite<int>::assert_true(!c.push(3), "Push after close should fail");
+    int v = 0;
+    tst_suite<int>::assert_true(c.pop(v) && v == 1, "Buffered values should drain after close");
+    tst_suite<int>::assert_true(c.pop(v) && v == 2, "Second buffered value should drain");
+    tst_suite<int>::assert_true(!c.pop(v), "Pop after drain should fail");
+}
+
+/**
+ * @brief Tests batch dequeue of partial and full batches
+ */
+void test_pop_batch() {
+    chan<int> c(16);
+    for (int i = 0; i < 10; ++i) { c.push(i); }
+
+    lst<int> out;
+    out.add(-1);
+    tst_suite<int>::assert_eq(c.pop_batch(out, 4), 4, "Partial batch should take 4");
+    tst_suite<int>::assert_eq(c.size(), 6, "Six values should remain buffered");
+    tst_suite<int>::assert_eq(c.pop_batch(out, 100), 6, "Full batch should take the rest");
+    tst_suite<int>::assert_eq(out.size(), 11, "Batches should be spliced after existing nodes");
+    for (size_t i = 1; i < out.size(); ++i) {
+        tst_suite<int>::assert_eq(out.get(i), static_cast<int>(i - 1), "Batch order should be FIFO");
+    }
+
+    // Room freed by a batch must be usable
+    c.push(42);
+    out.add(0);
+    tst_suite<int>::assert_eq(c.try_pop_batch(out, 8), 1, "Refilled channel should yield one value");
+    tst_suite<int>::assert_eq(out.get(out.size() - 1), 42, "Spliced value should be 42");
+    c.close();
+    tst_suite<int>::assert_eq(c.pop_batch(out, 8), 0, "Closed and drained channel should yield 0");
+}
+
+/**
+ * @brief Tests several producers and consumers over a small buffer
+ */
+void test_threads() {
+    chan<int> c(8);
+    const int per = 5000;
+    std::atomic<long long> sum{0};
+    std::atomic<int> count{0};
+
+    std::vector<std::thread> consumers;
+    for (int t = 0; t < 2; ++t) {
+        consumers.emplace_back([&]() {
+            lst<int> batch;
+            while (c.pop_batch(batch, 16) > 0) {
+                for (size_t i = 0; i < batch.size(); ++i) { sum += batch.get(i); }
+                count += static_cast<int>(batch.size());
+                batch = lst<int>();
+            }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 3; ++t) {
+        producers.emplace_back([&]() {
+            for (int i = 1; i <= per; ++i) { c.push(i); }
+        });
+    }
+    for (auto& t : producers) { t.join(); }
+    c.close();
+    for (auto& t : consumers) { t.join(); }
+
+    tst_suite<int>::assert_eq(count, 3 * per, "Every value should be consumed once");
+    tst_suite<int>::assert_true(sum == 3LL * per * (per + 1) / 2, "Sum of consumed values should match");
+}
+
+/**
+ * @brief Tests that a consumer about to block returns pooled nodes to the producer
+ */
+void test_idle_flush() {
+    struct payload { char b[40]; };
+    using pool = node_pool<sizeof(node<payload>), alignof(node<payload>)>;
+    chan<payload, pool_alloc> c(8);
+
+    // Seed this thread's free list so the pushed nodes are known blocks
+    std::vector<void*> seeded;
+    for (int i = 0; i < 3; ++i) { seeded.push_back(pool::allocate()); }
+    for (void* p : seeded) { pool::deallocate(p); }
+    for (int i = 0; i < 3; ++i) { c.push(payload{}); }
+
+    std::thread consumer([&]() {
+        payload v;
+        while (c.pop(v)) {}
+    });
+    while (c.size() > 0) { std::this_thread::yield(); }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // The consumer is blocked; its frees must already be back with this thread
+    std::vector<void*> again;
+    for (int i = 0; i < 3; ++i) { again.push_back(pool::allocate()); }
+    std::sort(seeded.begin(), seeded.end());
+    std::sort(again.begin(), again.end());
+    for (void* p : again) { pool::deallocate(p); }
+    c.close();
+    consumer.join();
+    tst_suite<int>::assert_true(seeded == again, "Blocked consumer should have flushed its frees");
+}
+
+#if CHAN_COROUTINES
+/**
+ * @brief Tests coroutine push/pop suspension and wake-up by threads
+ */
+void test_coroutines() {
+    chan<int> c(1);
+    std::vector<int> got;
+    bool finished = false;
+
+    auto consumer = [](chan<int>& c, std::vector<int>& got, bool& finished) -> task {
+        while (auto v = co_await c.pop_async()) { got.push_back(*v); }
+        finished = true;
+    };
+    consumer(c, got, finished);
+    tst_suite<int>::assert_true(got.empty(), "Consumer should be suspended on an empty channel");
+
+    c.push(1);
+    c.push(2);
+    tst_suite<int>::assert_eq(static_cast<int>(got.size()), 2, "Pushes should hand values to the consumer");
+
+    c.close();
+    tst_suite<int>::assert_true(finished, "close() should resume the consumer with nullopt");
+
+    chan<int> d(1);
+    bool pushed = false;
+    auto producer = [](chan<int>& d, bool& pushed) -> task {
+        co_await d.push_async(1);
+        pushed = co_await d.push_async(2);
+    };
+    producer(d, pushed);
+    tst_suite<int>::assert_true(!pushed, "Producer should be suspended on a full channel");
+    int v = 0;
+    d.pop(v);
+    tst_suite<int>::assert_true(pushed, "Pop should resume the producer");
+    d.pop(v);
+    tst_suite<int>::assert_eq(v, 2, "Resumed producer's value should be buffered");
+
+    // Awaiting a buffered value must not need a default-constructible T
+    struct boxed {
+        explicit boxed(int x) : v(x) {}
+        int v;
+    };
+    chan<boxed> e(1);
+    e.push(boxed(7));
+    int seen = 0;
+    auto reader = [](chan<boxed>& e, int& seen) -> task {
+        if (auto b = co_await e.pop_async()) { seen = b->v; }
+    };
+    reader(e, seen);
+    tst_suite<int>::assert_eq(seen, 7, "Buffered value should be returned without suspending");
+}
+#endif
+
+int main() {
+    // Create and configure test suite
+    tst_suite<int> suite;
+
+    // Add test cases
+    suite.add("Try Push and Pop", test_try_push_pop);
+    suite.add("Timed Push and Pop", test_timed);
+    suite.add("Close Semantics", test_close);
+    suite.add("Batch Dequeue", test_pop_batch);
+    suite.add("Producers and Consumers", test_threads);
+    suite.add("Idle Consumer Flushes Frees", test_idle_flush);
+#if CHAN_COROUTINES
+    suite.add("Coroutine Awaitables", test_coroutines);
+#endif
+    // Run all tests
+    suite.run();
+
+    return 0;
+}
@@ -0,0 +1,284 @@
+/****************************************************************************
+ * File: clist.hpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: This header file implements a templated singly linked list
+ * that can be shared between reader and writer threads. Readers traverse
+ * the list without taking any lock; writers serialize among themselves on a
+ * mutex and never block readers. Nodes unlinked by rem() are retired and
+ * only freed once every reader that could still observe them has left,
+ * using an epoch scheme with striped reader counters in the style of
+ * sleepable RCU. Nodes come from the allocation policy A (see alloc.hpp);
+ * pool_alloc suits writers and reclaimers running on different threads.
+ *
+ * Copyright (c) 2026 diyorsattarov. All rights reserved.
+ ****************************************************************************/
+
+#ifndef CLIST_HPP
+#define CLIST_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <alloc.hpp>
+
+template <typename T, typename A = heap_alloc>
+class clst {
+    public:
+        /**
+         * @brief Constructs an empty list
+         * @param batch Number of retired nodes collected before they are freed
+         * @post Creates a list with no elements and epoch 0
+         */
+        explicit clst(size_t batch = 64) : hd(nullptr), t1(nullptr), sz(0),
+                                           ep(0), rb(batch ? batch : 1) {
+            for (auto& c : rc) { c.n.store(0); }
+        }
+
+        // Copying or moving would race with readers of the source list
+        clst(const clst&) = delete;
+        clst& operator=(const clst&) = delete;
+        clst(clst&&) = delete;
+        clst& operator=(clst&&) = delete;
+
+        /**
+         * @brief Destructor that frees live and retired nodes
+         * @pre No reader or writer is using the list
+         */
+        ~clst() {
+            cnode* cur = hd.load(std::memory_order_relaxed);
+            while (cur) {
+                cnode* tmp = cur;
+                cur = cur->nxt.load(std::memory_order_relaxed);
+                A::destroy(tmp);
+            }
+            for (cnode* n : rt) { A::destroy(n); }
+        }
+
+        /**
+         * @brief RAII read-side critical section
+         * @post Nodes reachable while the guard is alive are not freed
+         */
+        class read_guard {
+            public:
+                explicit read_guard(const clst& l) : l(l), i(l.enter()) { ++depth(); }
+                ~read_guard() {
+                    --depth();
+                    l.rc[i].n.fetch_sub(1, std::memory_order_release);
+                }
+                read_guard(const read_guard&) = delete;
+                read_guard& operator=(const read_guard&) = delete;
+
+            private:
+                const clst& l;  // List whose reader counter was taken
+                size_t i;       // Index of that counter
+        };
+
+        /**
+         * @brief Adds a new element to the end of the list
+         * @param v The value to add to the list
+         * @post The node is published to readers once fully constructed
+         */
+        void add(const T& v) {
+            cnode* n = A::template make<cnode>(v);
+            std::lock_guard<std::mutex> lk(wm);
+            if (!t1) {
+                hd.store(n, std::memory_order_release);
+            } else {
+                t1->nxt.store(n, std::memory_order_release);
+            }
+            t1 = n;
+            sz.fetch_add(1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Removes the last element from the list
+         * @post The node is unlinked and retired; it is freed after a grace period
+         * @note A full batch is reclaimed by the caller after releasing the writer
+         * mutex, so add() never waits on readers. A caller inside a read section,
+         * such as a for_each() callback, leaves the batch pending instead, since the
+         * grace period would have to wait for the caller itself.
+         */
+        void rem() {
+            std::vector<cnode*> batch;
+            {
+                std::lock_guard<std::mutex> lk(wm);
+                if (!unlink_tail()) return;
+                if (rt.size() >= rb && depth() == 0) { batch.swap(rt); }
+            }
+            reclaim(batch);
+        }
+
+        /**
+         * @brief Retrieves the element at the specified index
+
+         * @param idx The zero-based index of the element to retrieve
+         * @return The value at the specified index
+         * @throws std::out_of_range if idx is past the end when the walk reaches it
+         */
+        T get(size_t idx) const {
+            read_guard g(*this);
+            cnode* cur = hd.load(std::memory_order_acquire);
+            for (size_t i = 0; i < idx && cur; ++i) {
+                cur = cur->nxt.load(std::memory_order_acquire);
+            }
+            if (!cur) { throw std::out_of_range("Index out of bounds"); }
+            return cur->v;
+        }
+
+        /**
+         * @brief Visits every element in order without blocking writers
+         * @param f Callable invoked with a const reference to each value
+         * @note Elements appended or removed during the walk may or may not be seen
+         */
+        template <typename F>
+        void for_each(F f) const {
+            read_guard g(*this);
+            cnode* cur = hd.load(std::memory_order_acquire);
+            while (cur) {
+                f(static_cast<const T&>(cur->v));
+                cur = cur->nxt.load(std::memory_order_acquire);
+            }
+        }
+
+        /**
+         * @brief Frees every retired node once all current readers have left
+         * @throws std::logic_error if called inside a read section, which would never end
+         * @post No node retired before the call is pending
+         */
+        void sync() {
+            if (depth() != 0) { throw std::logic_error("clst::sync() called under a read_guard"); }
+            std::vector<cnode*> batch;
+            {
+                std::lock_guard<std::mutex> lk(wm);
+                batch.swap(rt);
+            }
+            reclaim(batch);
+        }
+
+        /**
+         * @brief Returns the current number of elements in the list
+         * @return The size of the list
+         */
+        size_t size() const { return sz.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Returns the number of unlinked nodes awaiting reclamation
+         */
+        size_t retired() const {
+            std::lock_guard<std::mutex> lk(wm);
+            return rt.size();
+        }
+
+    private:
+        struct cnode {
+            T v;                        // Value stored in the node, immutable once published
+            std::atomic<cnode*> nxt;    // Pointer to the next node in the sequence
+
+            explicit cnode(const T& val) : v(val), nxt(nullptr) {}
+        };
+
+        // Reader counter padded to its own cache line
+        struct alignas(64) counter {
+            std::atomic<long> n;
+        };
+
+        static constexpr size_t stripes = 16;   // Reader counters per epoch parity
+
+        /**
+         * @brief Picks this thread's counter stripe, fixed for the thread's lifetime
+         */
+        static size_t stripe() {
+            static std::atomic<size_t> next{0};
+            static thread_local const size_t s = next.fetch_add(1) % stripes;
+            return s;
+        }
+
+        /**
+         * @brief Registers a reader in the current epoch
+         * @return Index of the counter to decrement when the reader leaves
+         */
+        size_t enter() const {
+            const size_t s = stripe();
+            for (;;) {
+                unsigned long e = ep.load();
+                size_t i = (e & 1) * stripes + s;
+                rc[i].n.fetch_add(1);
+                // A flip between the load and the increment could miss us; retry
+                if (ep.load() == e) { return i; }
+                rc[i].n.fetch_sub(1);
+            }
+        }
+
+        /**
+         * @brief Read sections held by this thread on lists of this type
+         */
+        static int& depth() {
+            static thread_local int d = 0;
+            return d;
+        }
+
+        /**
+         * @brief Unlinks the last node and retires it
+         * @pre The writer mutex is held
+         * @return false if the list was empty
+         */
+        bool unlink_tail() {
+            cnode* h = hd.load(std::memory_order_relaxed);
+            if (!h) return false;
+            cnode* old = t1;
+            if (h == old) {
+                hd.store(nullptr, std::memory_order_release);
+                t1 = nullptr;
+            } else {
+                cnode* cur = h;
+                while (cur->nxt.load(std::memory_order_relaxed) != old) {
+                    cur = cur->nxt.load(std::memory_order_relaxed);
+                }
+                cur->nxt.store(nullptr, std::memory_order_release);
+                t1 = cur;
+            }
+            sz.fetch_sub(1, std::memory_order_release);
+            rt.push_back(old);
+            return true;
+        }
+
+        /**
+         * @brief Waits for a grace period and frees a batch of retired nodes
+         * @param batch Nodes unlinked before the call, taken out of rt
+         * @pre The writer mutex is not held and the caller is not inside a read section
+         */
+        void reclaim(std::vector<cnode*>& batch) {
+            if (batch.empty()) return;
+            {
+                // Grace periods run one at a time so each flip drains the other parity
+                std::lock_guard<std::mutex> lk(gm);
+                unsigned long e = ep.fetch_add(1);
+                counter* old = &rc[(e & 1) * stripes];
+                for (size_t i = 0; i < stripes; ++i) {
+                    while (old[i].n.load() != 0) { std::this_thread::yield(); }
+                }
+            }
+            for (cnode* n : batch) { A::destroy(n); }
+            A::template flush<cnode>();
+        }
+
+        std::atomic<cnode*> hd;         // Pointer to the first node, read by readers
+        cnode* t1;                      // Pointer to the last node, writer-only
+        std::atomic<size_t> sz;         // Number of elements in the list
+        mutable std::atomic<unsigned long> ep;      // Epoch, its parity selects the counter set
+        mutable counter rc[2 * stripes];            // Active reader counts per parity and stripe
+        mutable std::mutex wm;          // Serializes writers
+        std::mutex gm;                  // Serializes grace periods
+        std::vector<cnode*> rt;         // Unlinked nodes awaiting a grace period
+        size_t rb;                      // Retired batch size that triggers reclamation
+};
+
+#endif // CLIST_HPP
@@ -0,0 +1,224 @@
+/****************************************************************************
+ * File: test_clist.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Test implementation for the clst<T> class. Covers the basic
+ * list operations, deferred reclamation of removed nodes, and a stress test
+ * with concurrent readers, an appender and a remover.
+ ****************************************************************************/
+#include <clist.hpp>
+#include <test_suite.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Tests basic addition, retrieval and removal
+ */
+void test_add_get_rem() {
+    clst<int> l;
+    l.add(1);
+    l.add(2);
+    l.add(3);
+
+    tst_suite<int>::assert_eq(l.size(), 3, "Size should be 3 after three additions");
+    tst_suite<int>::assert_eq(l.get(0), 1, "First element should be 1");
+    tst_suite<int>::assert_eq(l.get(2), 3, "Third element should be 3");
+
+    l.rem();
+    tst_suite<int>::assert_eq(l.size(), 2, "Size should be 2 after removal");
+    tst_suite<int>::assert_eq(l.get(1), 2, "Last element should be 2");
+
+    l.rem();
+    l.rem();
+    l.rem();  // Removing from an empty list is a no-op
+    tst_suite<int>::assert_eq(l.size(), 0, "List should be empty");
+}
+
+/**
+ * @brief Tests exception handling for out-of-bounds access
+ */
+void test_out_of_bounds() {
+    clst<int> l;
+    l.add(1);
+
+    try {
+        l.get(1);
+        throw std::runtime_error("Should have thrown out_of_range exception");
+    } catch (const std::out_of_range&) {
+        // Expected behavior
+    }
+}
+
+/**
+ * @brief Tests that removed nodes are retired in batches and freed by sync()
+ */
+void test_reclamation() {
+    clst<int> l(4);
+    for (int i = 0; i < 10; ++i) { l.add(i); }
+
+    l.rem();
+    l.rem();
+    l.rem();
+    tst_suite<int>::assert_eq(l.retired(), 3, "Three nodes should be pending");
+
+    l.rem();
+    tst_suite<int>::assert_eq(l.retired(), 0, "Reaching the batch size should reclaim");
+
+    l.rem();
+    l.sync();
+    tst_suite<int>::assert_eq(l.retired(), 0, "sync() should reclaim pending nodes");
+    tst_suite<int>::assert_eq(l.size(), 5, "Five elements should remain");
+}
+
+/**
+ * @brief Tests that a held read guard delays reclamation
+ */
+void test_guard_blocks_reclaim() {
+    clst<int> l;
+    l.add(1);
+    l.add(2);
+
+    std::atomic<bool> done{false};
+    std::thread writer;
+    {
+        clst<int>::read_guard g(l);
+        writer = std::thread([&]() {
+            l.rem();
+            l.sync();
+            done = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        tst_suite<int>::assert_true(!done, "sync() should wait for the active reader");
+    }
+    writer.join();
+    tst_suite<int>::assert_true(done, "sync() should finish once the reader leaves");
+}
+
+/**
+ * @brief Tests that add() is not held up by a grace period in progress
+ */
+void test_add_during_grace_period() {
+    clst<int> l;
+    l.add(1);
+    l.add(2);
+
+    std::atomic<bool> done{false};
+    std::thread writer;
+    {
+        clst<int>::read_guard g(l);
+        writer = std::thread([&]() {
+            l.rem();
+            l.sync();
+            done = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        l.add(3);   // Would block here if sync() held the writer mutex while waiting
+        tst_suite<int>::assert_true(!done, "sync() should still be waiting for the reader");
+    }
+    writer.join();
+    tst_suite<int>::assert_eq(static_cast<int>(l.size()), 2, "Size should reflect the add and the rem");
+}
+
+/**
+ * @brief Tests rem() from inside a read section, which defers reclamation
+ */
+void test_rem_under_guard() {
+    clst<int> l(2);
+    for (int i = 0; i < 10; ++i) { l.add(i); }
+
+    l.for_each([&](const int&) { l.rem(); });
+    tst_suite<int>::assert_true(l.retired() > 0, "Nodes removed under a guard should stay retired");
+
+    {
+        clst<int>::read_guard g(l);
+        try {
+            l.sync();
+            throw std::runtime_error("Should have thrown logic_error exception");
+        } catch (const std::logic_error&) {
+            // Expected behavior
+        }
+    }
+    l.sync();
+    tst_suite<int>::assert_eq(l.retired(), 0, "sync() outside the guard should free them");
+}
+
+/**
+ * @brief Stress test with concurrent readers, an appender and a remover
+ *
+ * Values are appended in increasing order and removed from the back, so any
+ * consistent traversal must observe a strictly increasing sequence.
+ */
+void test_concurrent_stress() {
+    clst<int> l(16);
+    const int adds = 20000;
+    std::atomic<bool> stop{false};
+    std::atomic<int> removed{0};
+    std::atomic<int> bad{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            while (!stop) {
+                int prev = -1;
+                l.for_each([&](const int& v) {
+                    if (v <= prev) { ++bad; }
+                    prev = v;
+                });
+                try {
+                    l.get(l.size() / 2);
+                } catch (const std::out_of_range&) {
+                    // The list may shrink between size() and get()
+                }
+            }
+        });
+    }
+
+    std::thread appender([&]() {
+        for (int i = 0; i < adds; ++i) { l.add(i); }
+    });
+    std::thread remover([&]() {
+        for (int i = 0; i < adds / 2; ++i) {
+            if (l.size() > 0) {
+                l.rem();
+                ++removed;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    appender.join();
+    remover.join();
+    stop = true;
+    for (auto& t : readers) { t.join(); }
+    l.sync();
+
+    tst_suite<int>::assert_eq(bad, 0, "Readers should only observe increasing values");
+    tst_suite<int>::assert_eq(static_cast<int>(l.size()), adds - removed,
+            "Size should equal additions minus removals");
+    tst_suite<int>::assert_eq(l.retired(), 0, "No nodes should be pending after sync()");
+}
+
+int main() {
+    // Create and configure test suite
+    tst_suite<int> suite;
+
+    // Add test cases
+    suite.add("Add, Get and Remove Operations", test_add_get_rem);
+    suite.add("Out of Bounds Handling", test_out_of_bounds);
+    suite.add("Batched Reclamation", test_reclamation);
+    suite.add("Read Guard Delays Reclamation", test_guard_blocks_reclaim);
+    suite.add("Add During Grace Period", test_add_during_grace_period);
+    suite.add("Remove Under Read Guard", test_rem_under_guard);
+    suite.add("Concurrent Stress", test_concurrent_stress);
+    // Run all tests
+    suite.run();
+
+    return 0;
+}
@@ -0,0 +1,273 @@
+/****************************************************************************
+ * File: lhmap.hpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: This header file implements a templated insertion-ordered
+ * hash map. Entries live directly in an open-addressing table with linear
+ * probing, and each entry links to its neighbours in insertion order the way
+ * node<T> links to the next node, using slot indices instead of pointers.
+ * This gives O(1) average find, erase and move-to-back by key with a single
+ * allocation for the whole table, which makes it a natural LRU cache.
+ *
+ * Copyright (c) 2026 diyorsattarov. All rights reserved.
+ ****************************************************************************/
+
+#ifndef LHMAP_HPP
+#define LHMAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+template <typename K, typename V, typename H = std::hash<K>>
+class lhmap {
+    public:
+        /**
+         * @brief Constructs an empty map
+         * @param capacity Number of entries to reserve room for
+         */
+        explicit lhmap(size_t capacity = 16) : hd(npos), t1(npos), sz(0) {
+            size_t n = 8;
+            while (n * 3 < capacity * 4) { n <<= 1; }
+            tbl.resize(n);
+        }
+
+        /**
+         * @brief Inserts a key or assigns to an existing one
+         * @param k The key
+         * @param v The value
+         * @return true if the key was new and appended at the back
+         * @post An existing key keeps its position in the order
+         */
+        bool put(const K& k, const V& v) {
+            if ((sz + 1) * 4 > tbl.size() * 3) { grow(); }
+            size_t h = mix(k);
+            size_t i = probe(k, h);
+            if (tbl[i].used) {
+                tbl[i].v = v;
+                return false;
+            }
+            slot& s = tbl[i];
+            s.k = k;
+            s.v = v;
+            s.h = h;
+            s.used = true;
+            link_back(i);
+            ++sz;
+            return true;
+        }
+
+        /**
+         * @brief Looks up a key
+         * @param k The key to find
+         * @return Pointer to the value, or nullptr if absent
+         */
+        V* find(const K& k) {
+            size_t i = probe(k, mix(k));
+            return tbl[i].used ? &tbl[i].v : nullptr;
+        }
+
+        const V* find(const K& k) const {
+            size_t i = probe(k, mix(k));
+            return tbl[i].used ? &tbl[i].v : nullptr;
+        }
+
+        /**
+         * @brief Retrieves the value for a key
+         * @param k The key to look up
+         * @return A copy of the value
+         * @throws std::out_of_range if the key is absent
+         */
+        V get(const K& k) const {
+            const V* v = find(k);
+            if (!v) { throw std::out_of_range("Key not found"); }
+            return *v;
+        }
+
+        /**
+         * @brief Removes a key
+         * @param k The key to remove
+         * @return true if the key was present
+         */
+        bool erase(const K& k) {
+            size_t i = probe(k, mix(k));
+            if (!tbl[i].used) return false;
+            unlink(i);
+            remove_slot(i);
+            --sz;
+            return true;
+        }
+
+        /**
+         * @brief Moves a key to the back of the order, as on an LRU hit
+         * @param k The key to move
+         * @return true if the key was present
+         */
+        bool move_to_back(const K& k) {
+            size_t i = probe(k, mix(k));
+            if (!tbl[i].used) return false;
+            if (i != t1) {
+                unlink(i);
+                link_back(i);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Retrieves the oldest entry
+         * @return The key and value at the front of the order
+         * @throws std::out_of_range if the map is empty
+         */
+        std::pair<K, V> front() const {
+            if (hd == npos) { throw std::out_of_range("Map is empty"); }
+            return {tbl[hd].k, tbl[hd].v};
+        }
+
+        /**
+         * @brief Removes the oldest entry, as on an LRU eviction
+         * @post The front entry is removed if the map is not empty
+         */
+        void pop_front() {
+            if (hd == npos) return;
+            size_t i = hd;
+            unlink(i);
+            remove_slot(i);
+            --sz;
+        }
+
+        /**
+         * @brief Visits every entry in order
+         * @param f Callable invoked with the key and a reference to the value
+         */
+        template <typename F>
+        void for_each(F f) {
+            for (size_t i = hd; i != npos; i = tbl[i].nxt) { f(static_cast<const K&>(tbl[i].k), tbl[i].v); }
+        }
+
+        /**
+         * @brief Returns the number of entries
+         */
+        size_t size() const { return sz; }
+
+        /**
+         * @brief Checks whether the map is empty
+         */
+        bool empty() const { return sz == 0; }
+
+    private:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        struct slot {
+            K k{};                  // Key
+            V v{};                  // Value
+            size_t h = 0;           // Cached hash of k
+            size_t prv = npos;      // Previous entry in order
+            size_t nxt = npos;      // Next entry in order
+            bool used = false;      // Whether the slot holds an entry
+        };
+
+        /**
+         * @brief Hashes k and spreads the bits over the table mask
+         */
+        size_t mix(const K& k) const {
+            unsigned long long h = H()(k);
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return static_cast<size_t>(h);
+        }
+
+        /**
+         * @brief Finds the slot holding k, or the empty slot where it belongs
+         */
+        size_t probe(const K& k, size_t h) const {
+            const size_t mask = tbl.size() - 1;
+            size_t i = h & mask;
+            while (tbl[i].used && !(tbl[i].h == h && tbl[i].k == k)) { i = (i + 1) & mask; }
+            return i;
+        }
+
+        /**
+         * @brief Links slot i at the back of the order
+         */
+        void link_back(size_t i) {
+            tbl[i].prv = t1;
+            tbl[i].nxt = npos;
+            if (t1 == npos) {
+                hd = i;
+            } else {
+                tbl[t1].nxt = i;
+            }
+            t1 = i;
+        }
+
+        /**
+         * @brief Unlinks slot i from the order
+         */
+        void unlink(size_t i) {
+            const size_t p = tbl[i].prv;
+            const size_t n = tbl[i].nxt;
+            if (p == npos) { hd = n; } else { tbl[p].nxt = n; }
+            if (n == npos) { t1 = p; } else { tbl[n].prv = p; }
+        }
+
+        /**
+         * @brief Empties slot i, shifting later probe-chain entries back
+         * @pre Slot i has been unlinked
+         */
+        void remove_slot(size_t i) {
+            const size_t mask = tbl.size() - 1;
+            size_t j = i;
+            for (;;) {
+                j = (j + 1) & mask;
+                if (!tbl[j].used) break;
+                const size_t home = tbl[j].h & mask;
+                // Leave j alone if its home lies cyclically in (i, j]
+                const bool stays = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+                if (stays) continue;
+                tbl[i] = std::move(tbl[j]);
+                relink(i);
+                i = j;
+            }
+            tbl[i] = slot();
+        }
+
+        /**
+         * @brief Points the neighbours of the entry now at slot i back at it
+         */
+        void relink(size_t i) {
+            if (tbl[i].prv == npos) { hd = i; } else { tbl[tbl[i].prv].nxt = i; }
+            if (tbl[i].nxt == npos) { t1 = i; } else { tbl[tbl[i].nxt].prv = i; }
+        }
+
+        /**
+         * @brief Doubles the table, reinserting entries in order
+         */
+        void grow() {
+            std::vector<slot> old(tbl.size() * 2);
+            old.swap(tbl);
+            size_t i = hd;
+            hd = npos;
+            t1 = npos;
+            while (i != npos) {
+                size_t next = old[i].nxt;
+                size_t j = probe(old[i].k, old[i].h);
+                tbl[j] = std::move(old[i]);
+                link_back(j);
+                i = next;
+            }
+        }
+
+        std::vector<slot> tbl;  // Open-addressing table, size is a power of two
+        size_t hd;              // Slot of the oldest entry
+        size_t t1;              // Slot of the newest entry
+        size_t sz;              // Number of entries
+};
+
+#endif // LHMAP_HPP
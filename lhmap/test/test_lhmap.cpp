@@ -0,0 +1,155 @@
+/****************************************************************************
+ * File: test_lhmap.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Test implementation for the lhmap<K, V> class. Verifies
+ * insertion order, lookup, erase with probe-chain repair, move-to-back,
+ * growth, and LRU-style eviction against a reference model.
+ ****************************************************************************/
+#include <lhmap.hpp>
+#include <test_suite.hpp>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Collects the keys of m in iteration order
+ */
+template <typename K, typename V>
+std::vector<K> keys(lhmap<K, V>& m) {
+    std::vector<K> out;
+    m.for_each([&](const K& k, V&) { out.push_back(k); });
+    return out;
+}
+
+/**
+ * @brief Tests put, find and insertion order
+ */
+void test_put_find() {
+    lhmap<std::string, int> m;
+    tst_suite<int>::assert_true(m.put("b", 2), "New key should be inserted");
+    tst_suite<int>::assert_true(m.put("a", 1), "New key should be inserted");
+    tst_suite<int>::assert_true(m.put("c", 3), "New key should be inserted");
+    tst_suite<int>::assert_true(!m.put("a", 10), "Existing key should be assigned");
+
+    tst_suite<int>::assert_eq(m.size(), 3, "Size should be 3");
+    tst_suite<int>::assert_eq(m.get("a"), 10, "a should be reassigned to 10");
+    tst_suite<int>::assert_true(m.find("z") == nullptr, "Missing key should not be found");
+    tst_suite<int>::assert_true(keys(m) == std::vector<std::string>({"b", "a", "c"}),
+            "Iteration should follow insertion order");
+}
+
+/**
+ * @brief Tests erase, move_to_back, front and pop_front
+ */
+void test_order_ops() {
+    lhmap<int, int> m;
+    for (int i = 0; i < 5; ++i) { m.put(i, i * i); }
+
+    tst_suite<int>::assert_true(m.erase(2), "Erase of a present key should succeed");
+    tst_suite<int>::assert_true(!m.erase(2), "Second erase should fail");
+    tst_suite<int>::assert_true(m.move_to_back(0), "move_to_back should find 0");
+    tst_suite<int>::assert_true(keys(m) == std::vector<int>({1, 3, 4, 0}), "Order should be 1 3 4 0");
+
+    tst_suite<int>::assert_eq(m.front().first, 1, "Front should be 1");
+    m.pop_front();
+    tst_suite<int>::assert_eq(m.front().first, 3, "Front should be 3 after pop");
+    tst_suite<int>::assert_eq(m.size(), 3, "Size should be 3");
+
+    try {
+        m.get(2);
+        throw std::runtime_error("Should have thrown out_of_range exception");
+    } catch (const std::out_of_range&) {
+        // Expected behavior
+    }
+}
+
+/**
+ * @brief Colliding hash so every key shares one probe chain
+ */
+struct collide {
+    size_t operator()(int) const { return 7; }
+};
+
+/**
+ * @brief Tests that erasing inside a probe chain keeps later keys reachable
+ */
+void test_probe_chain() {
+    lhmap<int, int, collide> m;
+    for (int i = 0; i < 6; ++i) { m.put(i, i); }
+    m.erase(1);
+    m.erase(4);
+    for (int i : {0, 2, 3, 5}) {
+        tst_suite<int>::assert_true(m.find(i) && *m.find(i) == i, "Shifted key should stay reachable");
+    }
+    m.move_to_back(2);
+    std::vector<int> order;
+    m.for_each([&](const int& k, int&) { order.push_back(k); });
+    tst_suite<int>::assert_true(order == std::vector<int>({0, 3, 5, 2}), "Order should survive shifts");
+}
+
+/**
+ * @brief Tests LRU use against a std::list + std::unordered_map model
+ */
+void test_lru_model() {
+    const size_t cap = 64;
+    lhmap<int, int> m;
+    std::list<int> ref;
+    std::unordered_map<int, std::list<int>::iterator> idx;
+
+    unsigned x = 12345;
+    for (int step = 0; step < 20000; ++step) {
+        x = x * 1103515245u + 12345u;
+        int k = static_cast<int>((x >> 16) % 200);
+        auto it = idx.find(k);
+        if (it != idx.end()) {
+            ref.splice(ref.end(), ref, it->second);
+            tst_suite<int>::assert_true(m.move_to_back(k), "Hit should be present");
+        } else {
+            if (ref.size() == cap) {
+                tst_suite<int>::assert_eq(m.front().first, ref.front(), "Evicted key should match");
+                idx.erase(ref.front());
+                ref.pop_front();
+                m.pop_front();
+            }
+            ref.push_back(k);
+            idx[k] = std::prev(ref.end());
+            m.put(k, step);
+        }
+    }
+    std::vector<int> expect(ref.begin(), ref.end());
+    tst_suite<int>::assert_true(keys(m) == expect, "Final order should match the model");
+}
+
+/**
+ * @brief Tests growth past the initial capacity
+ */
+void test_growth() {
+    lhmap<int, int> m(4);
+    for (int i = 0; i < 10000; ++i) { m.put(i, -i); }
+    for (int i = 0; i < 10000; i += 2) { m.erase(i); }
+    tst_suite<int>::assert_eq(m.size(), 5000, "Half the keys should remain");
+    tst_suite<int>::assert_eq(m.get(9999), -9999, "Last key should be found");
+    tst_suite<int>::assert_eq(m.front().first, 1, "Front should be the first odd key");
+}
+
+int main() {
+    // Create and configure test suite
+    tst_suite<int> suite;
+
+    // Add test cases
+    suite.add("Put and Find", test_put_find);
+    suite.add("Order Operations", test_order_ops);
+    suite.add("Probe Chain Repair", test_probe_chain);
+    suite.add("LRU Against Reference", test_lru_model);
+    suite.add("Growth", test_growth);
+    // Run all tests
+    suite.run();
+
+    return 0;
+}
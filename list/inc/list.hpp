@@ -4,13 +4,17 @@
  * Email: diyorsattarov@outlook.com
  *
  * Created: 2024-10-05
- * Last Modified: 2024-10-07
+ * Last Modified: 2026-10-19
  *
  * Description: This header file implements a templated singly linked list 
  * data structure. The list maintains head and tail pointers for efficient
  * operations and provides basic functionality including addition, removal,
  * and element access. The list dynamically allocates nodes as needed and
- * properly manages memory cleanup.
+ * properly manages memory cleanup. The last position reached by get() is
+ * cached so that sequential index loops run in amortized O(1) per access.
+ * An optional instrumentation policy (see list_stats.hpp) observes add, get
+ * and rem; the default policy compiles away. Nodes are obtained through an
+ * allocation policy (see alloc.hpp), plain new/delete by default.
  *
  * Copyright (c) 2024 diyorsattarov. All rights reserved.
  ****************************************************************************/
@@ -21,22 +25,24 @@
 #include <stdexcept>
 #include <cstddef>
 #include <node.hpp>
+#include <list_stats.hpp>
+#include <alloc.hpp>
 
-template <typename T>
+template <typename T, typename S = lst_no_stats, typename A = heap_alloc>
 class lst {
     public:
         /**
          * @brief Constructs an empty list
          * @post Creates a list with no elements, null head/tail pointers, and size 0
          */
-        lst() : hd(nullptr), t1(nullptr), sz(0) {}
+        lst() : hd(nullptr), t1(nullptr), sz(0), cn(nullptr), ci(0) {}
 
         /**
          * @brief Copy constructor - creates a deep copy of another list
          * @param other The list to copy from
          * @post Creates a new list with identical contents but separate memory
          */
-        lst(const lst& other) : hd(nullptr), t1(nullptr), sz(0) {
+        lst(const lst& other) : hd(nullptr), t1(nullptr), sz(0), cn(nullptr), ci(0) {
             // Copy each node from the other list
             node<T>* current = other.hd;
             while (current != nullptr) {
@@ -50,11 +56,14 @@ class lst {
          * @param other The list to move from
          * @post Takes ownership of other list's nodes, leaving other list empty
          */
-        lst(lst&& other) noexcept : hd(other.hd), t1(other.t1), sz(other.sz) {
+        lst(lst&& other) noexcept : hd(other.hd), t1(other.t1), sz(other.sz),
+                                    cn(other.cn), ci(other.ci) {
             // Clear the other list's pointers and size
             other.hd = nullptr;
             other.t1 = nullptr;
             other.sz = 0;
+            other.cn = nullptr;
+            other.ci = 0;
         }
 
         /**
@@ -68,13 +77,15 @@ class lst {
                 while (hd) {
                     node<T>* tmp = hd;
                     hd = hd->next();
-                    delete tmp;
+                    A::destroy(tmp);
                 }
 
                 // Reset member variables
                 hd = nullptr;
                 t1 = nullptr;
                 sz = 0;
+                cn = nullptr;
+                ci = 0;
 
                 // Copy from other list
                 node<T>* current = other.hd;
@@ -97,18 +108,22 @@ class lst {
                 while (hd) {
                     node<T>* tmp = hd;
                     hd = hd->next();
-                    delete tmp;
+                    A::destroy(tmp);
                 }
 
                 // Take ownership of other's resources
                 hd = other.hd;
                 t1 = other.t1;
                 sz = other.sz;
+                cn = other.cn;
+                ci = other.ci;
 
                 // Clear other list
                 other.hd = nullptr;
                 other.t1 = nullptr;
                 other.sz = 0;
+                other.cn = nullptr;
+                other.ci = 0;
             }
             return *this;
         }
@@ -121,7 +136,7 @@ class lst {
             while (hd) {
                 node<T>* tmp = hd;
                 hd = hd->next();
-                delete tmp;
+                A::destroy(tmp);
             }
         }
 
@@ -132,7 +147,7 @@ class lst {
          *       Size is incremented by 1
          */
         void add(const T& v) {
-            node<T>* new_node = new node<T>(v);
+            node<T>* new_node = A::template make<node<T>>(v);
             if (!hd) {
                 hd = new_node;
                 t1 = new_node;
@@ -141,6 +156,27 @@ class lst {
                 t1 = new_node;
             }
             ++sz;
+            S::on_add();
+        }
+
+        /**
+         * @brief Appends an already linked chain of nodes without copying
+         * @param first First node of the chain
+         * @param last Last node of the chain, reachable from first
+         * @param n Number of nodes in the chain
+         * @pre The nodes were allocated through the same policy A
+         * @post The list owns the chain; size is incremented by n
+         */
+        void splice_back(node<T>* first, node<T>* last, size_t n) {
+            if (!first) return;
+            last->l(nullptr);
+            if (!hd) {
+                hd = first;
+            } else {
+                t1->l(first);
+            }
+            t1 = last;
+            sz += n;
         }
 
         /**
@@ -148,11 +184,28 @@ class lst {
          * @param idx The zero-based index of the element to retrieve
          * @return The value at the specified index
          * @throws std::out_of_range if idx is >= size
+         * @note The walk resumes from the last accessed position when idx is at
+         *       or after it, so ascending index loops are amortized O(1)
+         *       Concurrent get() calls on one list must be synchronized since the
+         *       cached position is updated
          */
         T get(size_t idx) const {
             if (idx >= sz) { throw std::out_of_range("Index out of bounds"); }
+            if (idx == sz - 1) {
+                S::on_get(0);
+                return t1->get();
+            }
             node<T>* cur = hd;
-            for (size_t i = 0; i < idx && cur; ++i) { cur = cur->next(); }
+            size_t i = 0;
+            // Resume from the cached position instead of the head
+            if (cn && ci <= idx) {
+                cur = cn;
+                i = ci;
+            }
+            S::on_get(idx - i);
+            for (; i < idx && cur; ++i) { cur = cur->next(); }
+            cn = cur;
+            ci = idx;
             return cur ? cur->get() : T();
         }
 
@@ -164,15 +217,27 @@ class lst {
         void rem() {
             if (!hd) return;
             if (hd == t1) {
-                delete hd;
+                A::destroy(hd);
                 hd = nullptr;
                 t1 = nullptr;
+                cn = nullptr;
+                S::on_rem(0);
             } else {
                 node<T>* cur = hd;
-                while (cur->next() != t1) { cur = cur->next(); }
-                delete t1;
+                // The cached node is safe to start from unless it is the tail
+                size_t steps = 0;
+                if (cn && ci + 1 < sz) { cur = cn; }
+                while (cur->next() != t1) {
+                    cur = cur->next();
+                    ++steps;
+                }
+                S::on_rem(steps);
+                A::destroy(t1);
                 t1 = cur;
                 t1->l(nullptr);
+                // Cache the new tail so the removed node is never referenced
+                cn = t1;
+                ci = sz - 2;
             }
             --sz;
         }
@@ -187,6 +252,8 @@ class lst {
         node<T>* hd;    // Pointer to the first node in the list
         node<T>* t1;    // Pointer to the last node in the list
         size_t sz;      // Number of elements in the list
+        mutable node<T>* cn;    // Node reached by the last get() or rem()
+        mutable size_t ci;      // Index of the cached node
 };
 
 #endif // LIST_HPP
@@ -0,0 +1,203 @@
+/****************************************************************************
+ * File: list_stats.hpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Instrumentation policies for lst<T>. lst_no_stats is the
+ * default and consists of empty inline hooks that compile away entirely.
+ * lst_stats records per-operation call counts, total traversal steps and a
+ * log2 histogram of traversal lengths in thread-local counters, which are
+ * aggregated on demand and can be printed alongside benchmark_suite results.
+ *
+ * Copyright (c) 2026 diyorsattarov. All rights reserved.
+ ****************************************************************************/
+
+#ifndef LIST_STATS_HPP
+#define LIST_STATS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Default policy; every hook is empty
+ */
+struct lst_no_stats {
+    static void on_add() {}
+    static void on_get(size_t) {}
+    static void on_rem(size_t) {}
+};
+
+/**
+ * @brief Counting policy backed by thread-local counters
+ */
+class lst_stats {
+    public:
+        enum op { op_add, op_get, op_rem, op_count };
+        static constexpr size_t buckets = 32;   // Bucket k holds lengths in [2^(k-1), 2^k)
+
+        /**
+         * @brief Aggregated counters for every thread
+         */
+        struct totals {
+            uint64_t calls[op_count] = {};
+            uint64_t steps[op_count] = {};
+            uint64_t hist[op_count][buckets] = {};
+        };
+
+        static void on_add() { local().bump(op_add, 0); }
+        static void on_get(size_t steps) { local().bump(op_get, steps); }
+        static void on_rem(size_t steps) { local().bump(op_rem, steps); }
+
+        /**
+         * @brief Sums the counters of live and exited threads since the last reset
+         */
+        static totals collect() {
+            std::lock_guard<std::mutex> lk(state().m);
+            totals t = state().retired;
+            for (const block* b : state().live) { b->add_to(t); }
+            const totals& base = state().base;
+            for (size_t o = 0; o < op_count; ++o) {
+                t.calls[o] -= base.calls[o];
+                t.steps[o] -= base.steps[o];
+                for (size_t k = 0; k < buckets; ++k) { t.hist[o][k] -= base.hist[o][k]; }
+            }
+            return t;
+        }
+
+        /**
+         * @brief Starts a new measurement window
+         * @post collect() reports only operations after this call
+         */
+        static void reset() {
+            totals now = collect();
+            std::lock_guard<std::mutex> lk(state().m);
+            totals& base = state().base;
+            for (size_t o = 0; o < op_count; ++o) {
+                base.calls[o] += now.calls[o];
+                base.steps[o] += now.steps[o];
+                for (size_t k = 0; k < buckets; ++k) { base.hist[o][k] += now.hist[o][k]; }
+            }
+        }
+
+        /**
+         * @brief One-line summary of calls and average traversal lengths
+         */
+        static std::string summary() {
+            totals t = collect();
+            std::ostringstream os;
+            os << "add " << t.calls[op_add]
+                << " | get " << t.calls[op_get] << " avg " << avg(t, op_get) << " steps"
+                << " | rem " << t.calls[op_rem] << " avg " << avg(t, op_rem) << " steps";
+            return os.str();
+        }
+
+        /**
+         * @brief Writes the summary followed by the non-empty histogram buckets
+         * @param os Stream to write to
+         */
+        static void dump(std::ostream& os) {
+            totals t = collect();
+            os << summary() << "\n";
+            const char* names[op_count] = {"add", "get", "rem"};
+            for (size_t o = op_get; o < op_count; ++o) {
+                for (size_t k = 0; k < buckets; ++k) {
+                    if (!t.hist[o][k]) continue;
+                    os << "  " << names[o] << " steps "
+                        << (k ? (uint64_t(1) << (k - 1)) : 0) << "-"
+                        << (k ? (uint64_t(1) << k) - 1 : 0)
+                        << ": " << t.hist[o][k] << "\n";
+                }
+            }
+        }
+
+    private:
+        // Per-thread counters; only the owning thread writes them
+        struct block {
+            std::atomic<uint64_t> calls[op_count];
+            std::atomic<uint64_t> steps[op_count];
+            std::atomic<uint64_t> hist[op_count][buckets];
+
+            block() {
+                for (size_t o = 0; o < op_count; ++o) {
+                    calls[o].store(0, std::memory_order_relaxed);
+                    steps[o].store(0, std::memory_order_relaxed);
+                    for (auto& h : hist[o]) { h.store(0, std::memory_order_relaxed); }
+                }
+                std::lock_guard<std::mutex> lk(state().m);
+                state().live.push_back(this);
+            }
+
+            // Fold this thread's counts into the retired totals on exit
+            ~block() {
+                std::lock_guard<std::mutex> lk(state().m);
+                add_to(state().retired);
+                auto& live = state().live;
+                for (size_t i = 0; i < live.size(); ++i) {
+                    if (live[i] == this) {
+                        live[i] = live.back();
+                        live.pop_back();
+                        break;
+                    }
+                }
+            }
+
+            // Single writer, so a plain load/store pair avoids a locked RMW
+            static void inc(std::atomic<uint64_t>& c, uint64_t by) {
+                c.store(c.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+            }
+
+            void bump(op o, size_t n) {
+                inc(calls[o], 1);
+                inc(steps[o], n);
+                size_t k = 0;
+                while (n && k + 1 < buckets) {
+                    n >>= 1;
+                    ++k;
+                }
+                inc(hist[o][k], 1);
+            }
+
+            void add_to(totals& t) const {
+                for (size_t o = 0; o < op_count; ++o) {
+                    t.calls[o] += calls[o].load(std::memory_order_relaxed);
+                    t.steps[o] += steps[o].load(std::memory_order_relaxed);
+                    for (size_t k = 0; k < buckets; ++k) {
+                        t.hist[o][k] += hist[o][k].load(std::memory_order_relaxed);
+                    }
+                }
+            }
+        };
+
+        // Registry of live blocks and counts left behind by exited threads
+        struct registry {
+            std::mutex m;
+            std::vector<block*> live;
+            totals retired;
+            totals base;        // Counts at the last reset()
+        };
+
+        static registry& state() {
+            static registry r;
+            return r;
+        }
+
+        static block& local() {
+            static thread_local block b;
+            return b;
+        }
+
+        static double avg(const totals& t, op o) {
+            return t.calls[o] ? static_cast<double>(t.steps[o]) / t.calls[o] : 0.0;
+        }
+};
+
+#endif // LIST_STATS_HPP
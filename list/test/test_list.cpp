@@ -4,7 +4,7 @@
  * Email: diyorsattarov@outlook.com
  *
  * Created: 2024-10-05
- * Last Modified: 2024-10-07
+ * Last Modified: 2026-10-19
  *
  * Description: Test implementation for the lst<T> class. Implements various
  * test cases to verify the functionality of the linked list implementation
@@ -12,6 +12,8 @@
  ****************************************************************************/
 #include <list.hpp>
 #include <test_suite.hpp>
+#include <sstream>
+#include <thread>
 
 /**
  * @brief Tests copy constructor functionality
@@ -201,6 +203,140 @@ void test_out_of_bounds() {
     }
 }
 
+/**
+ * @brief Tests sequential and backward access through the cached position
+ */
+void test_cached_get() {
+    lst<int> test_lst;
+    for (int i = 0; i < 100; ++i) { test_lst.add(i); }
+
+    for (size_t i = 0; i < test_lst.size(); ++i) {
+        tst_suite<int>::assert_eq(test_lst.get(i), static_cast<int>(i),
+                "Sequential get should return the element at each index");
+    }
+
+    // Walking backward must restart from the head
+    tst_suite<int>::assert_eq(test_lst.get(50), 50, "get(50) should be 50 after a forward scan");
+    tst_suite<int>::assert_eq(test_lst.get(10), 10, "get(10) should be 10 after get(50)");
+    tst_suite<int>::assert_eq(test_lst.get(10), 10, "Repeated get(10) should be 10");
+}
+
+/**
+ * @brief Tests that add and rem keep the cached position valid
+ */
+void test_cached_get_after_mutation() {
+    lst<int> test_lst;
+    for (int i = 0; i < 10; ++i) { test_lst.add(i); }
+
+    // Cache the tail's predecessor, then remove around it
+    tst_suite<int>::assert_eq(test_lst.get(8), 8, "get(8) should be 8");
+    test_lst.rem();
+    test_lst.rem();
+    tst_suite<int>::assert_eq(test_lst.size(), 8, "Size should be 8 after two removals");
+    tst_suite<int>::assert_eq(test_lst.get(7), 7, "Last element should be 7");
+    tst_suite<int>::assert_eq(test_lst.get(3), 3, "get(3) should be 3");
+
+    test_lst.add(42);
+    tst_suite<int>::assert_eq(test_lst.get(8), 42, "Appended element should be reachable");
+
+    // Drain completely and refill
+    while (test_lst.size() > 0) { test_lst.rem(); }
+    test_lst.add(7);
+    tst_suite<int>::assert_eq(test_lst.get(0), 7, "Refilled list should start at 7");
+
+    // Cached position must not leak across assignment
+    lst<int> other;
+    for (int i = 0; i < 5; ++i) { other.add(i * 10); }
+    tst_suite<int>::assert_eq(other.get(3), 30, "get(3) should be 30");
+    other = test_lst;
+    tst_suite<int>::assert_eq(other.get(0), 7, "Assigned list should start at 7");
+}
+
+/**
+ * @brief Tests appending a pre-linked node chain
+ */
+void test_splice_back() {
+    lst<int> test_lst;
+    test_lst.add(1);
+
+    node<int>* a = new node<int>(2);
+    node<int>* b = new node<int>(3);
+    a->l(b);
+    test_lst.splice_back(a, b, 2);
+
+    tst_suite<int>::assert_eq(test_lst.size(), 3, "Size should be 3 after splicing two nodes");
+    tst_suite<int>::assert_eq(test_lst.get(2), 3, "Spliced tail should be 3");
+    test_lst.add(4);
+    tst_suite<int>::assert_eq(test_lst.get(3), 4, "add() should append after the spliced chain");
+
+    lst<int> empty;
+    node<int>* c = new node<int>(9);
+    empty.splice_back(c, c, 1);
+    tst_suite<int>::assert_eq(empty.get(0), 9, "Splicing into an empty list should set the head");
+}
+
+/**
+ * @brief Tests the counting instrumentation policy
+ */
+void test_stats() {
+    static_assert(sizeof(lst<int>) == sizeof(lst<int, lst_stats>),
+            "Instrumentation must not change the list layout");
+
+    lst_stats::reset();
+    lst<int, lst_stats> test_lst;
+    for (int i = 0; i < 10; ++i) { test_lst.add(i); }
+    for (size_t i = 0; i < test_lst.size(); ++i) { test_lst.get(i); }
+    test_lst.get(0);
+    test_lst.get(5);
+    test_lst.rem();
+
+    lst_stats::totals t = lst_stats::collect();
+    tst_suite<int>::assert_true(t.calls[lst_stats::op_add] == 10, "Ten adds should be counted");
+    tst_suite<int>::assert_true(t.calls[lst_stats::op_get] == 12, "Twelve gets should be counted");
+    // Sequential scan walks 8 single steps; get(5) from the head walks 5
+    tst_suite<int>::assert_true(t.steps[lst_stats::op_get] == 13, "Get steps should be 13");
+    tst_suite<int>::assert_true(t.calls[lst_stats::op_rem] == 1, "One rem should be counted");
+    tst_suite<int>::assert_true(t.hist[lst_stats::op_get][3] == 1, "get(5) should land in bucket 4-7");
+
+    // Counts from other threads are included after they exit
+    std::thread([]() {
+        lst<int, lst_stats> other;
+        other.add(1);
+    }).join();
+    t = lst_stats::collect();
+    tst_suite<int>::assert_true(t.calls[lst_stats::op_add] == 11, "Exited thread's add should be kept");
+
+    std::ostringstream os;
+    lst_stats::dump(os);
+    tst_suite<int>::assert_true(os.str().find("get 12") != std::string::npos,
+            "Dump should report the get count");
+
+    lst_stats::reset();
+    t = lst_stats::collect();
+    tst_suite<int>::assert_true(t.calls[lst_stats::op_get] == 0, "Reset should clear the window");
+}
+
+/**
+ * @brief Tests a list whose nodes come from the pooled allocation policy
+ */
+void test_pool_alloc() {
+    lst<int, lst_no_stats, pool_alloc> test_lst;
+    for (int i = 0; i < 1000; ++i) { test_lst.add(i); }
+    lst<int, lst_no_stats, pool_alloc> copy(test_lst);
+    tst_suite<int>::assert_eq(copy.get(999), 999, "Copy should hold every element");
+
+    // Another thread releases the nodes; they return to this thread's pool
+    std::thread([&]() {
+        lst<int, lst_no_stats, pool_alloc> moved(std::move(test_lst));
+        while (moved.size() > 0) { moved.rem(); }
+    }).join();
+    tst_suite<int>::assert_eq(test_lst.size(), 0, "Moved-from list should be empty");
+
+    test_lst.add(5);
+    tst_suite<int>::assert_eq(test_lst.get(0), 5, "Pooled list should be reusable");
+    tst_suite<int>::assert_eq(copy.size(), 1000, "Copy should be unaffected");
+}
+
 int main() {
     // Create and configure test suite
     tst_suite<int> suite;
@@ -216,6 +352,11 @@ int main() {
     suite.add("Copy Assignment", test_copy_assignment);
     suite.add("Move Assignment", test_move_assignment);
     suite.add("Self Assignment", test_self_assignment);   
+    suite.add("Cached Sequential Get", test_cached_get);
+    suite.add("Cached Get After Mutation", test_cached_get_after_mutation);
+    suite.add("Splice Back", test_splice_back);
+    suite.add("Instrumentation Policy", test_stats);
+    suite.add("Pooled Allocation Policy", test_pool_alloc);
     // Run all tests
     suite.run();
 
@@ -0,0 +1,322 @@
+/****************************************************************************
+ * File: olist.hpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: This header file implements a templated out-of-core list for
+ * trivially copyable elements. Elements are stored in fixed-size contiguous
+ * segments and at most a configured memory budget of segments is resident.
+ * When the budget is exceeded the least recently used segment is written to
+ * an anonymous temporary file as one block (a small header followed by the
+ * raw elements) and its memory is reused. Segments are paged back in on
+ * access. Misses on consecutive segments grow a read-ahead window that
+ * loads the following blocks in the same pass, so sequential scans read the
+ * file in long runs. The tail segment is always resident, so add() is O(1)
+ * apart from writing an evicted segment, and rem() is O(1) apart from reading
+ * back the previous segment when the tail empties.
+ *
+ * Copyright (c) 2026 diyorsattarov. All rights reserved.
+ ****************************************************************************/
+
+#ifndef OLIST_HPP
+#define OLIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <lhmap.hpp>
+
+template <typename T>
+class olst {
+    static_assert(std::is_trivially_copyable<T>::value,
+            "olst elements are written to disk byte for byte and must be trivially copyable");
+
+    public:
+        /**
+         * @brief Constructs an empty list
+         * @param budget Bytes of element storage that may be resident, at least two segments
+         * @param seg_bytes Bytes per segment, rounded down to whole elements
+         * @post No temporary file exists until the first segment is spilled
+         */
+        explicit olst(size_t budget, size_t seg_bytes = 64 * 1024)
+            : cap(seg_bytes / sizeof(T) ? seg_bytes / sizeof(T) : 1),
+              max_res(budget / (cap * sizeof(T)) > 2 ? budget / (cap * sizeof(T)) : 2),
+              sz(0), fend(0), cs(npos), last_miss(npos), ra(0), nread(0), nwritten(0) {}
+
+        // The list owns a file and buffers that cannot be shared
+        olst(const olst&) = delete;
+        olst& operator=(const olst&) = delete;
+        olst(olst&&) = delete;
+        olst& operator=(olst&&) = delete;
+
+        /**
+         * @brief Destructor that frees resident segments; the file is deleted on close
+         */
+        ~olst() {
+            for (seg& s : segs) { release(s.buf); }
+            for (T* b : spare) { release(b); }
+        }
+
+        /**
+         * @brief Adds an element to the end of the list
+         * @param v Value to add
+         * @throws std::runtime_error if an evicted segment cannot be written
+         * @post Size is incremented by 1
+         */
+        void add(const T& v) {
+            if (segs.empty() || segs.back().n == cap) {
+                if (!segs.empty()) { make_room(1); }
+                T* b = buffer();
+                try {
+                    segs.push_back(seg{b, 0, -1});
+                } catch (...) {
+                    spare.push_back(b);
+                    throw;
+                }
+                // The full previous tail becomes an ordinary, evictable segment
+                if (segs.size() > 1) { lru.put(segs.size() - 2, 0); }
+            }
+            seg& t = segs.back();
+            t.buf[t.n++] = v;
+            t.off = -1;
+            ++sz;
+        }
+
+        /**
+         * @brief Retrieves the element at an index
+         * @param idx Zero-based index
+         * @return A copy of the element; segments may move to disk after the call
+         * @throws std::out_of_range if idx is out of bounds
+         * @throws std::runtime_error if a segment cannot be read back
+         */
+        T get(size_t idx) {
+            if (idx >= sz) { throw std::out_of_range("Index out of bounds"); }
+            return at(idx / cap)[idx % cap];
+        }
+
+        /**
+         * @brief Removes the last element
+         * @throws std::runtime_error if the segment that becomes the tail cannot be
+         * paged in; the list is left unchanged
+         * @post Size is decremented by 1 if the list was not empty
+         */
+        void rem() {
+            if (sz == 0) return;
+            if (segs.back().n == 1) {
+                // Page in the next tail first so a failure leaves the list untouched
+                if (segs.size() > 1 && !segs[segs.size() - 2].buf) { load(segs.size() - 2, 0); }
+                spare.reserve(spare.size() + 1);
+            }
+            seg& t = segs.back();
+            --t.n;
+            t.off = -1;
+            --sz;
+            if (t.n > 0) return;
+
+            spare.push_back(t.buf);
+            segs.pop_back();
+            if (cs == segs.size()) { cs = npos; }
+            if (segs.empty()) {
+                fend = 0;   // No block is referenced any more
+                return;
+            }
+            // The new tail, resident since the load above, is never evicted
+            lru.erase(segs.size() - 1);
+        }
+
+        /**
+         * @brief Visits every element in order
+         * @param f Callable invoked with a const reference to each element
+         */
+        template <typename F>
+        void for_each(F f) {
+            for (size_t k = 0; k < segs.size(); ++k) {
+                const T* b = at(k);
+                const size_t n = segs[k].n;
+                for (size_t i = 0; i < n; ++i) { f(b[i]); }
+            }
+        }
+
+        /**
+         * @brief Returns the number of elements in the list
+         */
+        size_t size() const { return sz; }
+
+        /**
+         * @brief Returns the number of elements per segment
+         */
+        size_t segment_size() const { return cap; }
+
+        /**
+         * @brief Returns the number of segments currently in memory
+         */
+        size_t resident() const { return segs.empty() ? 0 : lru.size() + 1; }
+
+        /**
+         * @brief Returns the maximum number of segments kept in memory
+         */
+        size_t max_resident() const { return max_res; }
+
+        /**
+         * @brief Returns the bytes read from and written to the spill file so far
+         */
+        unsigned long long bytes_read() const { return nread; }
+        unsigned long long bytes_written() const { return nwritten; }
+
+    private:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+        static constexpr uint32_t magic = 0x4F4C5342;   // "OLSB"
+
+        // On-disk block header, followed by n raw elements
+        struct block_hdr {
+            uint32_t magic;
+            uint32_t n;
+        };
+
+        struct seg {
+            T* buf;         // Elements, or nullptr while spilled
+            size_t n;       // Number of elements in use
+            long long off;  // Offset of an up-to-date block in the file, or -1
+        };
+
+        struct file_closer {
+            void operator()(std::FILE* f) const { std::fclose(f); }
+        };
+
+        size_t cap;                     // Elements per segment
+        size_t max_res;                 // Resident segment limit, tail included
+        size_t sz;                      // Number of elements
+        std::vector<seg> segs;          // Segments in list order; the last is the tail
+        lhmap<size_t, char> lru;        // Resident non-tail segments, oldest first
+        std::vector<T*> spare;          // Buffers of evicted segments for reuse
+        std::unique_ptr<std::FILE, file_closer> file;
+        long long fend;                 // End of the last block written
+        size_t cs;                      // Segment touched by the previous access
+        size_t last_miss;               // Segment loaded by the previous miss
+        size_t ra;                      // Current read-ahead window in segments
+        unsigned long long nread;
+        unsigned long long nwritten;
+
+        static size_t block_bytes(size_t n) { return sizeof(block_hdr) + n * sizeof(T); }
+
+        T* buffer() {
+            if (!spare.empty()) {
+                T* b = spare.back();
+                spare.pop_back();
+                return b;
+            }
+            return static_cast<T*>(::operator new(cap * sizeof(T), std::align_val_t(alignof(T))));
+        }
+
+        static void release(T* b) {
+            if (b) { ::operator delete(b, std::align_val_t(alignof(T))); }
+        }
+
+        /**
+         * @brief Returns the elements of segment k, paging it in if needed
+         */
+        T* at(size_t k) {
+            if (k == cs) { return segs[k].buf; }
+            if (segs[k].buf) {
+                lru.move_to_back(k);    // No-op for the tail, which is not tracked
+                cs = k;
+                return segs[k].buf;
+            }
+            // Consecutive misses widen the window; any other miss resets it
+            const size_t limit = (max_res - 2) / 2;
+            if (last_miss != npos && k == last_miss + 1) {
+                ra = ra ? (ra * 2 < limit ? ra * 2 : limit) : (limit ? 1 : 0);
+            } else {
+                ra = 0;
+            }
+            load(k, ra);
+            // Only now, so a failed load never leaves the fast path on a spilled segment
+            cs = k;
+            return segs[k].buf;
+        }
+
+        /**
+         * @brief Evicts least recently used segments until n more fit in the budget
+         */
+        void make_room(size_t n) {
+            while (!lru.empty() && lru.size() + 1 + n > max_res) {
+                const size_t k = lru.front().first;
+                spill(k);
+                lru.pop_front();
+                if (k == cs) { cs = npos; }
+            }
+        }
+
+        /**
+         * @brief Moves segment k to disk, writing a block unless one is current
+         */
+        void spill(size_t k) {
+            seg& s = segs[k];
+            if (s.off < 0) {
+                if (!file) {
+                    file.reset(std::tmpfile());
+                    if (!file) { throw std::runtime_error("Cannot create spill file"); }
+                }
+                const block_hdr h{magic, static_cast<uint32_t>(s.n)};
+                seek(fend);
+                if (std::fwrite(&h, sizeof(h), 1, file.get()) != 1
+                        || std::fwrite(s.buf, sizeof(T), s.n, file.get()) != s.n) {
+                    throw std::runtime_error("Cannot write spill file");
+                }
+                s.off = fend;
+                fend += static_cast<long long>(block_bytes(s.n));
+                nwritten += block_bytes(s.n);
+            }
+            spare.push_back(s.buf);
+            s.buf = nullptr;
+        }
+
+        /**
+         * @brief Pages in segment k and up to ahead following spilled segments
+         * @post Read-ahead stops at the first segment whose block is not adjacent
+         */
+        void load(size_t k, size_t ahead) {
+            size_t last = k;
+            while (last - k < ahead && last + 1 < segs.size() && !segs[last + 1].buf
+                    && segs[last + 1].off == segs[last].off + static_cast<long long>(block_bytes(segs[last].n))) {
+                ++last;
+            }
+            make_room(last - k + 1);
+            seek(segs[k].off);
+            for (size_t j = k; j <= last; ++j) {
+                seg& s = segs[j];
+                block_hdr h;
+                T* b = buffer();
+                if (std::fread(&h, sizeof(h), 1, file.get()) != 1 || h.magic != magic || h.n != s.n
+                        || std::fread(b, sizeof(T), s.n, file.get()) != s.n) {
+                    spare.push_back(b);
+                    throw std::runtime_error("Corrupt or truncated spill block");
+                }
+                s.buf = b;
+                nread += block_bytes(s.n);
+                lru.put(j, 0);
+            }
+            // Keep the requested segment most recent so read-ahead evicts first
+            lru.move_to_back(k);
+            last_miss = last;
+        }
+
+        void seek(long long off) {
+            #ifdef _WIN32
+                const int r = _fseeki64(file.get(), off, SEEK_SET);
+            #else
+                const int r = fseeko(file.get(), static_cast<off_t>(off), SEEK_SET);
+            #endif
+            if (r != 0) { throw std::runtime_error("Cannot seek spill file"); }
+        }
+};
+
+#endif // OLIST_HPP
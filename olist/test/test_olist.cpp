@@ -0,0 +1,153 @@
+/****************************************************************************
+ * File: test_olist.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Test implementation for the olst<T> class. Uses small
+ * segments and budgets so that spilling, paging in, read-ahead and removal
+ * across spilled segments are all exercised, and checks a random operation
+ * sequence against std::vector.
+ ****************************************************************************/
+#include <olist.hpp>
+#include <test_suite.hpp>
+#include <random>
+#include <vector>
+
+struct rec {
+    long long id;
+    double w;
+    int tag;
+};
+
+/**
+ * @brief Tests basic addition, retrieval and removal within the budget
+ */
+void test_add_get_rem() {
+    olst<int> l(1 << 20);
+    l.add(1);
+    l.add(2);
+    l.add(3);
+
+    tst_suite<int>::assert_eq(static_cast<int>(l.size()), 3, "Size should be 3 after three additions");
+    tst_suite<int>::assert_eq(l.get(0), 1, "First element should be 1");
+    tst_suite<int>::assert_eq(l.get(2), 3, "Third element should be 3");
+
+    l.rem();
+    tst_suite<int>::assert_eq(l.get(1), 2, "Last element should be 2");
+    l.rem();
+    l.rem();
+    l.rem();  // Removing from an empty list is a no-op
+    tst_suite<int>::assert_eq(static_cast<int>(l.size()), 0, "List should be empty");
+    tst_suite<int>::assert_true(l.bytes_written() == 0, "Nothing should be spilled within the budget");
+}
+
+/**
+ * @brief Tests exception handling for out-of-bounds access
+ */
+void test_out_of_bounds() {
+    olst<int> l(1024);
+    l.add(1);
+
+    try {
+        l.get(1);
+        throw std::runtime_error("Should have thrown out_of_range exception");
+    } catch (const std::out_of_range&) {
+        // Expected behavior
+    }
+}
+
+/**
+ * @brief Tests that segments beyond the budget are spilled and read back intact
+ */
+void test_spill_and_page_in() {
+    // 4 records per segment, 3 segments resident
+    olst<rec> l(3 * 4 * sizeof(rec), 4 * sizeof(rec));
+    const long long n = 1000;
+    for (long long i = 0; i < n; ++i) {
+        l.add(rec{i, i * 0.5, static_cast<int>(i % 7)});
+        tst_suite<int>::assert_true(l.resident() <= l.max_resident(), "Resident segments should stay in budget");
+    }
+    tst_suite<int>::assert_true(l.bytes_written() > 0, "Cold segments should be spilled");
+
+    std::mt19937 rng(7);
+    for (int i = 0; i < 2000; ++i) {
+        const long long k = static_cast<long long>(rng() % n);
+        const rec r = l.get(static_cast<size_t>(k));
+        tst_suite<int>::assert_true(r.id == k && r.w == k * 0.5 && r.tag == k % 7,
+                "Paged-in record should match what was added");
+        tst_suite<int>::assert_true(l.resident() <= l.max_resident(), "Paging in should respect the budget");
+    }
+}
+
+/**
+ * @brief Tests sequential traversal with read-ahead over a mostly spilled list
+ */
+void test_sequential_scan() {
+    // 16 ints per segment, 10 segments resident, 100 segments in total
+    olst<int> l(10 * 64, 64);
+    for (int i = 0; i < 1600; ++i) { l.add(i); }
+
+    int expect = 0;
+    bool ordered = true;
+    bool bounded = true;
+    l.for_each([&](const int& v) {
+        ordered &= v == expect++;
+        bounded &= l.resident() <= l.max_resident();
+    });
+    tst_suite<int>::assert_true(ordered && expect == 1600, "Scan should visit every element in order");
+    tst_suite<int>::assert_true(bounded, "Read-ahead should respect the budget");
+
+    const unsigned long long before = l.bytes_read();
+    for (size_t i = 0; i < l.size(); ++i) { l.get(i); }
+    tst_suite<int>::assert_true(l.bytes_read() > before, "Index scan should page segments back in");
+    tst_suite<int>::assert_true(l.bytes_read() - before <= 2 * 100 * (64 + 8),
+            "Each segment should be read at most about once per scan");
+}
+
+/**
+ * @brief Tests random additions, removals and reads against std::vector
+ */
+void test_against_reference() {
+    olst<int> l(4 * 32, 32);    // 8 ints per segment, 4 segments resident
+    std::vector<int> ref;
+    std::mt19937 rng(11);
+    bool same = true;
+
+    for (int step = 0; step < 20000; ++step) {
+        const unsigned r = rng() % 10;
+        if (r < 5) {
+            const int v = static_cast<int>(rng());
+            l.add(v);
+            ref.push_back(v);
+        } else if (r < 8) {
+            l.rem();
+            if (!ref.empty()) { ref.pop_back(); }
+        } else if (!ref.empty()) {
+            const size_t i = rng() % ref.size();
+            same &= l.get(i) == ref[i];
+        }
+        same &= l.size() == ref.size();
+    }
+    size_t i = 0;
+    l.for_each([&](const int& v) { same &= v == ref[i++]; });
+    tst_suite<int>::assert_true(same, "List should match the reference after every step");
+}
+
+int main() {
+    // Create and configure test suite
+    tst_suite<int> suite;
+
+    // Add test cases
+    suite.add("Add, Get and Remove Operations", test_add_get_rem);
+    suite.add("Out of Bounds Handling", test_out_of_bounds);
+    suite.add("Spill and Page In", test_spill_and_page_in);
+    suite.add("Sequential Scan", test_sequential_scan);
+    suite.add("Against Reference", test_against_reference);
+    // Run all tests
+    suite.run();
+
+    return 0;
+}
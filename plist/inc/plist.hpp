@@ -0,0 +1,197 @@
+/****************************************************************************
+ * File: plist.hpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: This header file implements a templated persistent immutable
+ * singly linked list. push_front() and pop_front() leave the original list
+ * untouched and return a new version that shares its tail through
+ * reference-counted nodes, so taking a snapshot is a single reference count
+ * increment regardless of length. Nodes are released iteratively so
+ * dropping a long list cannot overflow the stack.
+ *
+ * Copyright (c) 2026 diyorsattarov. All rights reserved.
+ ****************************************************************************/
+
+#ifndef PLIST_HPP
+#define PLIST_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+template <typename T>
+class plst {
+    public:
+        /**
+         * @brief Constructs an empty list
+         * @post Creates a list with a null head and size 0
+         */
+        plst() : hd(nullptr), sz(0) {}
+
+        /**
+         * @brief Copy constructor - shares the other list's nodes
+         * @param other The list to snapshot
+         * @post Both lists refer to the same nodes; O(1) time and memory
+         */
+        plst(const plst& other) : hd(other.hd), sz(other.sz) { acquire(hd); }
+
+        /**
+         * @brief Move constructor - takes the other list's reference
+         * @param other The list to move from
+         * @post other is left empty
+         */
+        plst(plst&& other) noexcept : hd(other.hd), sz(other.sz) {
+            other.hd = nullptr;
+            other.sz = 0;
+        }
+
+        /**
+         * @brief Copy assignment operator
+         * @param other The list to share nodes with
+         * @return Reference to this list
+         */
+        plst& operator=(const plst& other) {
+            if (this != &other) {  // Prevent self-assignment
+                acquire(other.hd);
+                release(hd);
+                hd = other.hd;
+                sz = other.sz;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator
+         * @param other The list to move from
+         * @return Reference to this list
+         */
+        plst& operator=(plst&& other) noexcept {
+            if (this != &other) {  // Prevent self-assignment
+                release(hd);
+                hd = other.hd;
+                sz = other.sz;
+                other.hd = nullptr;
+                other.sz = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor that drops this version's reference
+         * @post Nodes no longer reachable from any version are freed
+         */
+        ~plst() { release(hd); }
+
+        /**
+         * @brief Returns a new list with v prepended
+         * @param v The value to place at the front
+         * @return A list of size() + 1 whose tail is this list
+         */
+        plst push_front(const T& v) const {
+            // Allocate first so a throwing new or copy leaves the count untouched
+            pnode* n = new pnode(v, hd);
+            acquire(hd);
+            return plst(n, sz + 1);
+        }
+
+        /**
+         * @brief Returns the list without its first element
+         * @return A list sharing every node after the head
+         * @throws std::out_of_range if the list is empty
+         */
+        plst pop_front() const {
+            if (!hd) { throw std::out_of_range("List is empty"); }
+            acquire(hd->nxt);
+            return plst(hd->nxt, sz - 1);
+        }
+
+        /**
+         * @brief Retrieves the first element
+         * @return The value at the head of the list
+         * @throws std::out_of_range if the list is empty
+         */
+        const T& front() const {
+            if (!hd) { throw std::out_of_range("List is empty"); }
+            return hd->v;
+        }
+
+        /**
+         * @brief Retrieves the element at the specified index
+         * @param idx The zero-based index of the element to retrieve
+         * @return The value at the specified index
+         * @throws std::out_of_range if idx is >= size
+         */
+        T get(size_t idx) const {
+            if (idx >= sz) { throw std::out_of_range("Index out of bounds"); }
+            pnode* cur = hd;
+            for (size_t i = 0; i < idx; ++i) { cur = cur->nxt; }
+            return cur->v;
+        }
+
+        /**
+         * @brief Visits every element from front to back
+         * @param f Callable invoked with a const reference to each value
+         */
+        template <typename F>
+        void for_each(F f) const {
+            for (pnode* cur = hd; cur; cur = cur->nxt) { f(static_cast<const T&>(cur->v)); }
+        }
+
+        /**
+         * @brief Checks whether two lists are the same version
+         * @return true if both lists share their head node
+         */
+        bool shares(const plst& other) const { return hd == other.hd; }
+
+        /**
+         * @brief Returns the current number of elements in the list
+         * @return The size of the list
+         */
+        size_t size() const { return sz; }
+
+        /**
+         * @brief Checks whether the list is empty
+         */
+        bool empty() const { return sz == 0; }
+
+    private:
+        struct pnode {
+            const T v;                  // Value stored in the node
+            pnode* const nxt;           // Shared tail, owned through one reference
+            std::atomic<size_t> rc;     // Number of lists and nodes referring here
+
+            pnode(const T& val, pnode* next) : v(val), nxt(next), rc(1) {}
+        };
+
+        /**
+         * @brief Adopts a head node whose reference has already been taken
+         */
+        plst(pnode* head, size_t size) : hd(head), sz(size) {}
+
+        /**
+         * @brief Takes a reference to n, if any
+         */
+        static void acquire(pnode* n) {
+            if (n) { n->rc.fetch_add(1, std::memory_order_relaxed); }
+        }
+
+        /**
+         * @brief Drops a reference to n and frees the unreachable prefix
+         */
+        static void release(pnode* n) {
+            while (n && n->rc.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                pnode* next = n->nxt;
+                delete n;
+                n = next;
+            }
+        }
+
+        pnode* hd;      // Pointer to the first node, holds one reference
+        size_t sz;      // Number of elements in the list
+};
+
+#endif // PLIST_HPP
@@ -0,0 +1,154 @@
+/****************************************************************************
+ * File: test_plist.cpp
+ * Author: Diyor Sattarov
+ * Email: diyorsattarov@outlook.com
+ *
+ * Created: 2026-10-19
+ * Last Modified: 2026-10-19
+ *
+ * Description: Test implementation for the plst<T> class. Verifies that
+ * push_front and pop_front produce new versions without disturbing old ones,
+ * that snapshots share structure, and that long lists are released safely.
+ ****************************************************************************/
+#include <plist.hpp>
+#include <test_suite.hpp>
+#include <string>
+
+/**
+ * @brief Tests that push_front and pop_front leave the original intact
+ */
+void test_versions() {
+    plst<int> empty;
+    plst<int> a = empty.push_front(1);
+    plst<int> b = a.push_front(2);
+    plst<int> c = b.push_front(3);
+
+    tst_suite<int>::assert_eq(empty.size(), 0, "Empty list should stay empty");
+    tst_suite<int>::assert_eq(a.size(), 1, "a should have one element");
+    tst_suite<int>::assert_eq(c.size(), 3, "c should have three elements");
+    tst_suite<int>::assert_eq(c.get(0), 3, "First element of c should be 3");
+    tst_suite<int>::assert_eq(c.get(2), 1, "Last element of c should be 1");
+
+    plst<int> d = c.pop_front();
+    tst_suite<int>::assert_true(d.shares(b), "pop_front should return the shared tail");
+    tst_suite<int>::assert_eq(c.front(), 3, "c should be unchanged by pop_front");
+    tst_suite<int>::assert_eq(d.front(), 2, "d should start at 2");
+}
+
+/**
+ * @brief Tests that copies are O(1) snapshots of the same nodes
+ */
+void test_snapshot() {
+    plst<int> l;
+    for (int i = 0; i < 100; ++i) { l = l.push_front(i); }
+
+    plst<int> snap(l);
+    tst_suite<int>::assert_true(snap.shares(l), "Snapshot should share nodes");
+
+    l = l.pop_front().pop_front().push_front(-1);
+    tst_suite<int>::assert_eq(snap.size(), 100, "Snapshot should keep its size");
+    tst_suite<int>::assert_eq(snap.front(), 99, "Snapshot should keep its head");
+    tst_suite<int>::assert_eq(l.front(), -1, "Modified list should start at -1");
+    tst_suite<int>::assert_eq(l.get(1), 97, "Modified list should share 97 onward");
+
+    int expected = 99;
+    bool ordered = true;
+    snap.for_each([&](const int& v) { ordered = ordered && v == expected--; });
+    tst_suite<int>::assert_true(ordered, "Snapshot traversal should be unchanged");
+}
+
+/**
+ * @brief Tests non-trivial payloads and assignment between versions
+ */
+void test_string_payload() {
+    plst<std::string> l;
+    l = l.push_front("tail").push_front("head");
+
+    plst<std::string> m;
+    m = l;
+    l = plst<std::string>();
+    tst_suite<int>::assert_eq(m.size(), 2, "Assigned list should keep both nodes");
+    tst_suite<int>::assert_true(m.front() == "head", "Front should be head");
+    tst_suite<int>::assert_true(m.get(1) == "tail", "Second should be tail");
+}
+
+/**
+ * @brief Tests error handling on empty lists and bad indices
+ */
+void test_out_of_bounds() {
+    plst<int> l;
+    try {
+        l.pop_front();
+        throw std::runtime_error("Should have thrown out_of_range exception");
+    } catch (const std::out_of_range&) {
+        // Expected behavior
+    }
+    l = l.push_front(1);
+    try {
+        l.get(1);
+        throw std::runtime_error("Should have thrown out_of_range exception");
+    } catch (const std::out_of_range&) {
+        // Expected behavior
+    }
+}
+
+/**
+ * @brief Tests that releasing a very long list does not recurse
+ */
+void test_long_release() {
+    plst<int> l;
+    for (int i = 0; i < 1000000; ++i) { l = l.push_front(i); }
+    plst<int> snap(l);
+    l = plst<int>();
+    tst_suite<int>::assert_eq(snap.size(), 1000000, "Snapshot should survive release of l");
+    snap = plst<int>();
+    tst_suite<int>::assert_true(snap.empty(), "Snapshot should be empty after reset");
+}
+
+/**
+ * @brief Tests that a throwing copy in push_front() does not leak the shared tail
+ */
+void test_push_front_throws() {
+    struct counted {
+        static int& live() { static int n = 0; return n; }
+        static bool& fail() { static bool f = false; return f; }
+        int v;
+        explicit counted(int x) : v(x) { ++live(); }
+        counted(const counted& o) : v(o.v) {
+            if (fail()) throw std::runtime_error("copy failed");
+            ++live();
+        }
+        ~counted() { --live(); }
+    };
+
+    {
+        plst<counted> l;
+        for (int i = 0; i < 3; ++i) { l = l.push_front(counted(i)); }
+        counted::fail() = true;
+        try {
+            l.push_front(counted(9));
+        } catch (const std::runtime_error&) {
+            // Expected behavior
+        }
+        counted::fail() = false;
+        tst_suite<int>::assert_eq(static_cast<int>(l.size()), 3, "Failed push should leave the list intact");
+    }
+    tst_suite<int>::assert_eq(counted::live(), 0, "Every node should be freed after a failed push");
+}
+
+int main() {
+    // Create and configure test suite
+    tst_suite<int> suite;
+
+    // Add test cases
+    suite.add("Push and Pop Versions", test_versions);
+    suite.add("O(1) Snapshots", test_snapshot);
+    suite.add("String Payload", test_string_payload);
+    suite.add("Out of Bounds Handling", test_out_of_bounds);
+    suite.add("Long List Release", test_long_release);
+    suite.add("Throwing Push Front", test_push_front_throws);
+    // Run all tests
+    suite.run();
+
+    return 0;
+}